@@ -0,0 +1,671 @@
+#include "CaseConversion.h"
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+
+#if defined(__AVX2__)
+#define CHROMA_CASE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CHROMA_CASE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Chroma
+{
+    namespace
+    {
+        enum class Case
+        {
+            Upper,
+            Lower,
+            Fold
+        };
+
+        char32_t ToLowerTwoByte(char32_t c)
+        {
+            if (c >= 0xC0 && c <= 0xDE && c != 0xD7)
+                return c + 0x20;
+            // Dotted capital I lowercases to a one byte i, so it's left alone
+            if (c >= 0x100 && c <= 0x137 && c != 0x130)
+                return c | 1;
+            if (c >= 0x139 && c <= 0x148)
+                return (c & 1) ? c + 1 : c;
+            if (c >= 0x14A && c <= 0x177)
+                return c | 1;
+            if (c == 0x178)
+                return 0xFF;
+            if (c >= 0x179 && c <= 0x17E)
+                return (c & 1) ? c + 1 : c;
+            if (c == 0x370 || c == 0x372 || c == 0x376 || c == 0x3F7 || c == 0x3FA)
+                return c + 1;
+            if (c == 0x37F)
+                return 0x3F3;
+            if (c == 0x386)
+                return 0x3AC;
+            if (c >= 0x388 && c <= 0x38A)
+                return c + 0x25;
+            if (c == 0x38C)
+                return 0x3CC;
+            if (c == 0x38E || c == 0x38F)
+                return c + 0x3F;
+            if (c >= 0x391 && c <= 0x3AB && c != 0x3A2)
+                return c + 0x20;
+            if (c == 0x3CF)
+                return 0x3D7;
+            if (c >= 0x3D8 && c <= 0x3EF)
+                return c | 1;
+            if (c == 0x3F4)
+                return 0x3B8;
+            if (c == 0x3F9)
+                return 0x3F2;
+            if (c >= 0x3FD && c <= 0x3FF)
+                return c - 0x82;
+            if (c >= 0x400 && c <= 0x40F)
+                return c + 0x50;
+            if (c >= 0x410 && c <= 0x42F)
+                return c + 0x20;
+            if ((c >= 0x460 && c <= 0x481) || (c >= 0x48A && c <= 0x4BF) || (c >= 0x4D0 && c <= 0x52F))
+                return c | 1;
+            if (c >= 0x4C1 && c <= 0x4CE)
+                return (c & 1) ? c + 1 : c;
+            if (c == 0x4C0)
+                return 0x4CF;
+            if (c >= 0x531 && c <= 0x556)
+                return c + 0x30;
+            return c;
+        }
+
+        char32_t ToUpperTwoByte(char32_t c)
+        {
+            if (c >= 0xE0 && c <= 0xFE && c != 0xF7)
+                return c - 0x20;
+            if (c == 0xFF)
+                return 0x178;
+            if (c == 0xB5)
+                return 0x39C;
+            // Dotless small i uppercases to a one byte I, so it's left alone
+            if (c >= 0x100 && c <= 0x137 && c != 0x131)
+                return c & ~char32_t(1);
+            if (c >= 0x139 && c <= 0x148)
+                return (c & 1) ? c : c - 1;
+            if (c >= 0x14A && c <= 0x177)
+                return c & ~char32_t(1);
+            if (c >= 0x179 && c <= 0x17E)
+                return (c & 1) ? c : c - 1;
+            if (c == 0x345)
+                return 0x399;
+            if (c == 0x371 || c == 0x373 || c == 0x377 || c == 0x3F8 || c == 0x3FB)
+                return c - 1;
+            if (c >= 0x37B && c <= 0x37D)
+                return c + 0x82;
+            if (c == 0x3F3)
+                return 0x37F;
+            if (c == 0x3AC)
+                return 0x386;
+            if (c >= 0x3AD && c <= 0x3AF)
+                return c - 0x25;
+            if (c == 0x3CC)
+                return 0x38C;
+            if (c == 0x3CD || c == 0x3CE)
+                return c - 0x3F;
+            if (c == 0x3C2)
+                return 0x3A3;
+            if (c >= 0x3B1 && c <= 0x3CB)
+                return c - 0x20;
+            if (c == 0x3D0)
+                return 0x392;
+            if (c == 0x3D1)
+                return 0x398;
+            if (c == 0x3D5)
+                return 0x3A6;
+            if (c == 0x3D6)
+                return 0x3A0;
+            if (c == 0x3D7)
+                return 0x3CF;
+            if (c >= 0x3D8 && c <= 0x3EF)
+                return c & ~char32_t(1);
+            if (c == 0x3F0)
+                return 0x39A;
+            if (c == 0x3F1)
+                return 0x3A1;
+            if (c == 0x3F2)
+                return 0x3F9;
+            if (c == 0x3F5)
+                return 0x395;
+            if (c >= 0x430 && c <= 0x44F)
+                return c - 0x20;
+            if (c >= 0x450 && c <= 0x45F)
+                return c - 0x50;
+            if ((c >= 0x460 && c <= 0x481) || (c >= 0x48A && c <= 0x4BF) || (c >= 0x4D0 && c <= 0x52F))
+                return c & ~char32_t(1);
+            if (c >= 0x4C1 && c <= 0x4CE)
+                return (c & 1) ? c : c - 1;
+            if (c == 0x4CF)
+                return 0x4C0;
+            if (c >= 0x561 && c <= 0x586)
+                return c - 0x30;
+            return c;
+        }
+
+        // Lowercase letters whose folded form is a different lowercase letter: micro sign, ypogegrammeni,
+        // final sigma and the Greek symbol variants
+        char32_t FoldTwoByte(char32_t c)
+        {
+            switch (c)
+            {
+            case 0xB5:
+                return 0x3BC;
+            case 0x345:
+                return 0x3B9;
+            case 0x3C2:
+                return 0x3C3;
+            case 0x3D0:
+                return 0x3B2;
+            case 0x3D1:
+                return 0x3B8;
+            case 0x3D5:
+                return 0x3C6;
+            case 0x3D6:
+                return 0x3C0;
+            case 0x3F0:
+                return 0x3BA;
+            case 0x3F1:
+                return 0x3C1;
+            case 0x3F5:
+                return 0x3B5;
+            default:
+                return ToLowerTwoByte(c);
+            }
+        }
+
+        // Greek Extended, U+1F00 to U+1FFF; titlecase letters with ypogegrammeni map to and from their lowercase forms,
+        // which is what simple case mapping does with them
+        // Prosgegrammeni is left alone, since its other forms are two bytes
+        char32_t ToLowerGreekExtended(char32_t c)
+        {
+            const auto low = c & 0xFF;
+            if (low <= 0x6F || (low >= 0x80 && low <= 0xAF))
+            {
+                // Blocks of eight lowercase letters followed by their eight uppercase forms, skipping the unassigned slots
+                const auto unassigned = low == 0x1E || low == 0x1F || low == 0x4E || low == 0x4F || low == 0x58 || low == 0x5A || low == 0x5C || low == 0x5E;
+                return (low & 0x08) && !unassigned ? c - 8 : c;
+            }
+
+            switch (low)
+            {
+            case 0xB8:
+            case 0xB9:
+            case 0xD8:
+            case 0xD9:
+            case 0xE8:
+            case 0xE9:
+                return c - 8;
+            case 0xBA:
+            case 0xBB:
+                return c - 0x4A;
+            case 0xBC:
+            case 0xCC:
+            case 0xFC:
+                return c - 9;
+            case 0xC8:
+            case 0xC9:
+            case 0xCA:
+            case 0xCB:
+                return c - 0x56;
+            case 0xDA:
+            case 0xDB:
+                return c - 0x64;
+            case 0xEA:
+            case 0xEB:
+                return c - 0x70;
+            case 0xEC:
+                return c - 7;
+            case 0xF8:
+            case 0xF9:
+                return c - 0x80;
+            case 0xFA:
+            case 0xFB:
+                return c - 0x7E;
+            default:
+                return c;
+            }
+        }
+
+        char32_t ToUpperGreekExtended(char32_t c)
+        {
+            const auto low = c & 0xFF;
+            if (low <= 0x6F || (low >= 0x80 && low <= 0xAF))
+            {
+                const auto upper = (low & 0x08) ? c : c + 8;
+                // Only code points whose uppercase slot is assigned
+                return ToLowerGreekExtended(upper) == c ? upper : c;
+            }
+
+            switch (low)
+            {
+            case 0x70:
+            case 0x71:
+                return c + 0x4A;
+            case 0x72:
+            case 0x73:
+            case 0x74:
+            case 0x75:
+                return c + 0x56;
+            case 0x76:
+            case 0x77:
+                return c + 0x64;
+            case 0x78:
+            case 0x79:
+                return c + 0x80;
+            case 0x7A:
+            case 0x7B:
+                return c + 0x70;
+            case 0x7C:
+            case 0x7D:
+                return c + 0x7E;
+            case 0xB0:
+            case 0xB1:
+            case 0xD0:
+            case 0xD1:
+            case 0xE0:
+            case 0xE1:
+                return c + 8;
+            case 0xB3:
+            case 0xC3:
+            case 0xF3:
+                return c + 9;
+            case 0xE5:
+                return c + 7;
+            default:
+                return c;
+            }
+        }
+
+        template<Case mode>
+        char ConvertAscii(char c)
+        {
+            if constexpr (mode == Case::Upper)
+                return c >= 'a' && c <= 'z' ? static_cast<char>(c ^ 0x20) : c;
+            else
+                return c >= 'A' && c <= 'Z' ? static_cast<char>(c ^ 0x20) : c;
+        }
+
+        bool IsContinuation(std::uint8_t byte)
+        {
+            return (byte & 0xC0) == 0x80;
+        }
+
+        // Converts the character starting at position into output and returns its length
+        template<Case mode>
+        size_t ConvertOne(std::string_view input, size_t position, char* output)
+        {
+            const auto lead = static_cast<std::uint8_t>(input[position]);
+            if (lead < 0x80)
+            {
+                output[0] = ConvertAscii<mode>(input[position]);
+                return 1;
+            }
+
+            const auto remaining = input.size() - position;
+            if (lead >= 0xC2 && lead <= 0xDF && remaining >= 2 && IsContinuation(input[position + 1]))
+            {
+                const auto decoded = (char32_t(lead & 0x1F) << 6) | (input[position + 1] & 0x3F);
+                char32_t converted;
+                if constexpr (mode == Case::Upper)
+                    converted = ToUpperTwoByte(decoded);
+                else if constexpr (mode == Case::Lower)
+                    converted = ToLowerTwoByte(decoded);
+                else
+                    converted = FoldTwoByte(decoded);
+
+                output[0] = static_cast<char>(0xC0 | (converted >> 6));
+                output[1] = static_cast<char>(0x80 | (converted & 0x3F));
+                return 2;
+            }
+
+            if (lead == 0xE1 && remaining >= 3 && IsContinuation(input[position + 1]) && IsContinuation(input[position + 2]) &&
+                (static_cast<std::uint8_t>(input[position + 1]) & 0xFC) == 0xBC)
+            {
+                const auto decoded = 0x1000 | (char32_t(input[position + 1] & 0x3F) << 6) | (input[position + 2] & 0x3F);
+                const auto converted = mode == Case::Upper ? ToUpperGreekExtended(decoded) : ToLowerGreekExtended(decoded);
+
+                output[0] = input[position];
+                output[1] = static_cast<char>(0x80 | ((converted >> 6) & 0x3F));
+                output[2] = static_cast<char>(0x80 | (converted & 0x3F));
+                return 3;
+            }
+
+            size_t length = 1;
+            if (lead >= 0xE0 && lead <= 0xEF)
+                length = 3;
+            else if (lead >= 0xF0 && lead <= 0xF4)
+                length = 4;
+
+            if (length > remaining)
+                length = 1;
+            for (size_t i = 1; i < length; ++i)
+            {
+                if (!IsContinuation(input[position + i]))
+                {
+                    length = 1;
+                    break;
+                }
+            }
+
+            for (size_t i = 0; i < length; ++i)
+                output[i] = input[position + i];
+            return length;
+        }
+
+#if defined(CHROMA_CASE_AVX2)
+        // Converts whole blocks while they're pure ASCII; returns where the scalar path needs to take over
+        template<Case mode>
+        size_t ConvertAsciiBlocks(std::string_view input, char* output, size_t position)
+        {
+            constexpr size_t width = 32;
+            const auto rangeBegin = _mm256_set1_epi8(mode == Case::Upper ? 'a' - 1 : 'A' - 1);
+            const auto rangeEnd = _mm256_set1_epi8(mode == Case::Upper ? 'z' + 1 : 'Z' + 1);
+            const auto flip = _mm256_set1_epi8(0x20);
+            for (; position + width <= input.size(); position += width)
+            {
+                const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input.data() + position));
+                if (_mm256_movemask_epi8(block) != 0)
+                    return position;
+
+                const auto letters = _mm256_and_si256(_mm256_cmpgt_epi8(block, rangeBegin), _mm256_cmpgt_epi8(rangeEnd, block));
+                const auto converted = _mm256_xor_si256(block, _mm256_and_si256(letters, flip));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + position), converted);
+            }
+
+            return position;
+        }
+#elif defined(CHROMA_CASE_SSE2)
+        template<Case mode>
+        size_t ConvertAsciiBlocks(std::string_view input, char* output, size_t position)
+        {
+            constexpr size_t width = 16;
+            const auto rangeBegin = _mm_set1_epi8(mode == Case::Upper ? 'a' - 1 : 'A' - 1);
+            const auto rangeEnd = _mm_set1_epi8(mode == Case::Upper ? 'z' + 1 : 'Z' + 1);
+            const auto flip = _mm_set1_epi8(0x20);
+            for (; position + width <= input.size(); position += width)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + position));
+                if (_mm_movemask_epi8(block) != 0)
+                    return position;
+
+                const auto letters = _mm_and_si128(_mm_cmpgt_epi8(block, rangeBegin), _mm_cmplt_epi8(block, rangeEnd));
+                const auto converted = _mm_xor_si128(block, _mm_and_si128(letters, flip));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + position), converted);
+            }
+
+            return position;
+        }
+#else
+        template<Case mode>
+        size_t ConvertAsciiBlocks(std::string_view input, char* output, size_t position)
+        {
+            return position;
+        }
+#endif
+
+        template<Case mode>
+        void Convert(std::string_view input, char* output)
+        {
+            size_t position = 0;
+            while (position < input.size())
+            {
+                position = ConvertAsciiBlocks<mode>(input, output, position);
+                if (position == input.size())
+                    break;
+
+                // Scalar through the block that stopped the vector loop, then try vectors again
+                const auto resumeAt = position + 16;
+                while (position < input.size() && position < resumeAt)
+                    position += ConvertOne<mode>(input, position, output + position);
+            }
+        }
+
+        constexpr auto npos = std::string_view::npos;
+
+#if defined(CHROMA_CASE_AVX2)
+        // Compares whole blocks while both sides are pure ASCII; returns where the scalar path needs to take over, or npos on a mismatch
+        size_t EqualAsciiBlocks(const char* left, const char* right, size_t size, size_t position)
+        {
+            constexpr size_t width = 32;
+            const auto rangeBegin = _mm256_set1_epi8('A' - 1);
+            const auto rangeEnd = _mm256_set1_epi8('Z' + 1);
+            const auto flip = _mm256_set1_epi8(0x20);
+            const auto fold = [&](__m256i block)
+            {
+                const auto letters = _mm256_and_si256(_mm256_cmpgt_epi8(block, rangeBegin), _mm256_cmpgt_epi8(rangeEnd, block));
+                return _mm256_or_si256(block, _mm256_and_si256(letters, flip));
+            };
+
+            for (; position + width <= size; position += width)
+            {
+                const auto leftBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + position));
+                const auto rightBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + position));
+                if (_mm256_movemask_epi8(_mm256_or_si256(leftBlock, rightBlock)) != 0)
+                    return position;
+
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(fold(leftBlock), fold(rightBlock))) != -1)
+                    return npos;
+            }
+
+            return position;
+        }
+
+        constexpr size_t candidateWidth = 32;
+
+        // Bit i is set when the byte at i is either case of the ASCII letter
+        std::uint32_t CandidateMask(const char* at, char lower, char upper)
+        {
+            const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at));
+            const auto matches = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(lower)), _mm256_cmpeq_epi8(block, _mm256_set1_epi8(upper)));
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+        }
+#elif defined(CHROMA_CASE_SSE2)
+        size_t EqualAsciiBlocks(const char* left, const char* right, size_t size, size_t position)
+        {
+            constexpr size_t width = 16;
+            const auto rangeBegin = _mm_set1_epi8('A' - 1);
+            const auto rangeEnd = _mm_set1_epi8('Z' + 1);
+            const auto flip = _mm_set1_epi8(0x20);
+            const auto fold = [&](__m128i block)
+            {
+                const auto letters = _mm_and_si128(_mm_cmpgt_epi8(block, rangeBegin), _mm_cmplt_epi8(block, rangeEnd));
+                return _mm_or_si128(block, _mm_and_si128(letters, flip));
+            };
+
+            for (; position + width <= size; position += width)
+            {
+                const auto leftBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + position));
+                const auto rightBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + position));
+                if (_mm_movemask_epi8(_mm_or_si128(leftBlock, rightBlock)) != 0)
+                    return position;
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(fold(leftBlock), fold(rightBlock))) != 0xFFFF)
+                    return npos;
+            }
+
+            return position;
+        }
+
+        constexpr size_t candidateWidth = 16;
+
+        std::uint32_t CandidateMask(const char* at, char lower, char upper)
+        {
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+            const auto matches = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(lower)), _mm_cmpeq_epi8(block, _mm_set1_epi8(upper)));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+        }
+#else
+        size_t EqualAsciiBlocks(const char* left, const char* right, size_t size, size_t position)
+        {
+            return position;
+        }
+
+        constexpr size_t candidateWidth = 1;
+
+        std::uint32_t CandidateMask(const char* at, char lower, char upper)
+        {
+            return *at == lower || *at == upper;
+        }
+#endif
+    }
+
+    void ToUppercase(std::string_view input, char* output)
+    {
+        Convert<Case::Upper>(input, output);
+    }
+
+    void ToLowercase(std::string_view input, char* output)
+    {
+        Convert<Case::Lower>(input, output);
+    }
+
+    void CaseFold(std::string_view input, char* output)
+    {
+        Convert<Case::Fold>(input, output);
+    }
+
+    void ToUppercaseInPlace(std::string& string)
+    {
+        ToUppercase(string, string.data());
+    }
+
+    void ToLowercaseInPlace(std::string& string)
+    {
+        ToLowercase(string, string.data());
+    }
+
+    void CaseFoldInPlace(std::string& string)
+    {
+        CaseFold(string, string.data());
+    }
+
+    bool EqualsIgnoreCase(std::string_view left, std::string_view right)
+    {
+        // Folding never changes the encoded length, so positions line up on both sides
+        if (left.size() != right.size())
+            return false;
+
+        size_t position = 0;
+        while (position < left.size())
+        {
+            position = EqualAsciiBlocks(left.data(), right.data(), left.size(), position);
+            if (position == npos)
+                return false;
+            if (position == left.size())
+                break;
+
+            const auto resumeAt = position + 16;
+            while (position < left.size() && position < resumeAt)
+            {
+                char leftFolded[4];
+                char rightFolded[4];
+                const auto length = ConvertOne<Case::Fold>(left, position, leftFolded);
+                if (ConvertOne<Case::Fold>(right, position, rightFolded) != length || std::memcmp(leftFolded, rightFolded, length) != 0)
+                    return false;
+                position += length;
+            }
+        }
+
+        return true;
+    }
+
+    bool StartsWithIgnoreCase(std::string_view input, std::string_view prefix)
+    {
+        return prefix.size() <= input.size() && EqualsIgnoreCase(input.substr(0, prefix.size()), prefix);
+    }
+
+    bool EndsWithIgnoreCase(std::string_view input, std::string_view suffix)
+    {
+        return suffix.size() <= input.size() && EqualsIgnoreCase(input.substr(input.size() - suffix.size()), suffix);
+    }
+
+    size_t FindIgnoreCase(std::string_view input, std::string_view of, size_t from)
+    {
+        if (from > input.size())
+            return npos;
+        if (of.empty())
+            return from;
+        if (of.size() > input.size() - from)
+            return npos;
+
+        // One past the last position a match can start at
+        const auto end = input.size() - of.size() + 1;
+        const auto matchesAt = [&](size_t position)
+        {
+            return EqualsIgnoreCase(input.substr(position, of.size()), of);
+        };
+
+        if (static_cast<std::uint8_t>(of[0]) >= 0x80)
+        {
+            // Matches start on a character boundary, unless the needle itself starts with a stray continuation byte
+            const auto anyPosition = IsContinuation(of[0]);
+            for (auto position = from; position < end; ++position)
+                if ((anyPosition || !IsContinuation(input[position])) && matchesAt(position))
+                    return position;
+            return npos;
+        }
+
+        // Only positions holding either case of the first byte can start a match
+        const auto lower = ConvertAscii<Case::Lower>(of[0]);
+        const auto upper = ConvertAscii<Case::Upper>(of[0]);
+        auto position = from;
+        for (; position + candidateWidth <= input.size(); position += candidateWidth)
+        {
+            for (auto mask = CandidateMask(input.data() + position, lower, upper); mask != 0; mask &= mask - 1)
+            {
+                const auto candidate = position + std::countr_zero(mask);
+                if (candidate >= end)
+                    return npos;
+                if (matchesAt(candidate))
+                    return candidate;
+            }
+        }
+
+        for (; position < end; ++position)
+            if ((input[position] == lower || input[position] == upper) && matchesAt(position))
+                return position;
+        return npos;
+    }
+
+    size_t HashIgnoreCase(std::string_view input)
+    {
+        constexpr size_t chunkSize = 64;
+        char folded[chunkSize];
+        std::uint64_t hash = 0xCBF29CE484222325 ^ input.size();
+        size_t position = 0;
+        while (position < input.size())
+        {
+            auto end = std::min(position + chunkSize, input.size());
+            // Keep multibyte sequences whole so they fold; strings that fold the same split in the same places
+            for (size_t backedUp = 0; backedUp < 3 && end < input.size() && IsContinuation(input[end]); ++backedUp)
+                --end;
+
+            const auto chunk = input.substr(position, end - position);
+            CaseFold(chunk, folded);
+
+            size_t i = 0;
+            for (; i + 8 <= chunk.size(); i += 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, folded + i, sizeof(word));
+                hash = (hash ^ word) * 0x9E3779B97F4A7C15;
+                hash ^= hash >> 32;
+            }
+
+            for (; i < chunk.size(); ++i)
+                hash = (hash ^ static_cast<std::uint8_t>(folded[i])) * 0x100000001B3;
+
+            position = end;
+        }
+
+        return static_cast<size_t>(hash);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace Chroma
+{
+    // ASCII is converted a whole vector register at a time
+    // Latin-1, Latin Extended-A, Greek and Coptic, Cyrillic, Cyrillic Supplement, Armenian and Greek Extended go through their
+    // simple case mappings, except for the few that would change the encoded length; other characters and invalid bytes are copied unchanged
+    // output needs room for input.size() bytes and may be the same buffer as input
+
+    void ToUppercase(std::string_view input, char* output);
+    void ToLowercase(std::string_view input, char* output);
+    // Lowercase, plus the few characters whose folded form differs from their lowercase form
+    void CaseFold(std::string_view input, char* output);
+
+    void ToUppercaseInPlace(std::string& string);
+    void ToLowercaseInPlace(std::string& string);
+    void CaseFoldInPlace(std::string& string);
+
+    // Case-insensitive means equal once both sides are case folded, worked out without building the folded strings
+    [[nodiscard]] bool EqualsIgnoreCase(std::string_view left, std::string_view right);
+    [[nodiscard]] bool StartsWithIgnoreCase(std::string_view input, std::string_view prefix);
+    [[nodiscard]] bool EndsWithIgnoreCase(std::string_view input, std::string_view suffix);
+    [[nodiscard]] size_t FindIgnoreCase(std::string_view input, std::string_view of, size_t from = 0);
+    [[nodiscard]] size_t HashIgnoreCase(std::string_view input);
+
+    // Transparent, so unordered containers keyed by std::string can be searched with any string_view
+    struct CaseInsensitiveHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view input) const
+        {
+            return HashIgnoreCase(input);
+        }
+    };
+
+    struct CaseInsensitiveEqual
+    {
+        using is_transparent = void;
+
+        bool operator()(std::string_view left, std::string_view right) const
+        {
+            return EqualsIgnoreCase(left, right);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <algorithm>
+
+namespace Chroma
+{
+    template<class T>
+    struct FromCharsResult
+    {
+        T value = T();
+        // std::errc() on success
+        // invalid_argument when the text is not entirely a number, result_out_of_range when it doesn't fit in T
+        std::errc error = std::errc();
+
+        [[nodiscard]] explicit operator bool() const
+        {
+            return error == std::errc();
+        }
+    };
+
+    // Parses all of text as a decimal integer or a floating point number with std::from_chars
+    // A leading '+' is accepted, surrounding whitespace is not
+    // Never allocates or consults the locale
+    template<class T>
+    [[nodiscard]] FromCharsResult<T> FromChars(std::string_view text)
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "FromChars requires an integral or floating point type.");
+
+        if (text.size() > 1 && text[0] == '+' && text[1] != '-')
+            text.remove_prefix(1);
+
+        FromCharsResult<T> result;
+        const auto end = text.data() + text.size();
+        const auto [parsedEnd, error] = std::from_chars(text.data(), end, result.value);
+        result.error = error;
+        if (error == std::errc() && parsedEnd != end)
+            result.error = std::errc::invalid_argument;
+        else if (error != std::errc())
+            result.value = T();
+
+        return result;
+    }
+
+    namespace detail
+    {
+        template<class T>
+        constexpr bool IsCharConvertible =
+            std::is_floating_point_v<T> ||
+            (std::is_integral_v<T> &&
+                !std::is_same_v<T, bool> &&
+                !std::is_same_v<T, wchar_t> &&
+                !std::is_same_v<T, char8_t> &&
+                !std::is_same_v<T, char16_t> &&
+                !std::is_same_v<T, char32_t>);
+
+        constexpr size_t ExponentDigits(int maxExponent10)
+        {
+            size_t digits = 1;
+            while (maxExponent10 >= 10)
+            {
+                maxExponent10 /= 10;
+                ++digits;
+            }
+
+            return digits;
+        }
+
+        template<class T>
+        constexpr size_t MaxChars()
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                // Sign, significand, point, "e-" and exponent
+                return 1 + std::numeric_limits<T>::max_digits10 + 1 + 2 + ExponentDigits(std::numeric_limits<T>::max_exponent10);
+            else
+                // Sign and one more digit than digits10 guarantees
+                return 1 + std::numeric_limits<T>::digits10 + 1;
+        }
+
+        template<class T>
+        constexpr size_t MaxFixedChars()
+        {
+            // Sign, every digit before the point, the point, and enough digits after it to reach the smallest subnormal
+            return 1 + std::numeric_limits<T>::max_exponent10 + 1 + 1 +
+                -std::numeric_limits<T>::min_exponent10 + std::numeric_limits<T>::max_digits10 + std::numeric_limits<T>::digits10;
+        }
+
+        // For a number from_chars matched but reported out of range, tells whether it was too large rather than too small
+        // Only the decimal order of magnitude is needed, which is the position of the first significant digit plus the exponent
+        inline bool IsFloatOverflow(std::string_view number)
+        {
+            size_t position = !number.empty() && number[0] == '-' ? 1 : 0;
+            long long integerDigits = 0;
+            long long leadingZeros = 0;
+            auto seenDigit = false;
+            auto seenPoint = false;
+            for (; position < number.size() && number[position] != 'e' && number[position] != 'E'; ++position)
+            {
+                const auto character = number[position];
+                if (character == '.')
+                {
+                    seenPoint = true;
+                    continue;
+                }
+
+                if (!seenDigit && character == '0')
+                {
+                    if (seenPoint)
+                        ++leadingZeros;
+                    continue;
+                }
+
+                seenDigit = true;
+                if (!seenPoint)
+                    ++integerDigits;
+            }
+
+            long long exponent = 0;
+            if (position < number.size())
+            {
+                ++position;
+                const auto negative = position < number.size() && number[position] == '-';
+                if (position < number.size() && (number[position] == '-' || number[position] == '+'))
+                    ++position;
+
+                // Anything past this is far out of range either way
+                constexpr long long exponentCap = 1000000000;
+                for (; position < number.size(); ++position)
+                    exponent = std::min(exponent * 10 + (number[position] - '0'), exponentCap);
+                if (negative)
+                    exponent = -exponent;
+            }
+
+            const auto magnitude = integerDigits > 0 ? integerDigits - 1 : -(leadingZeros + 1);
+            return magnitude + exponent > 0;
+        }
+
+        // How FromCharsSaturating treats text starting with '-' for unsigned types
+        enum class NegativeUnsigned
+        {
+            // Gives 0, like the strtoll based parsing the small integer specializations used
+            Clamp,
+            // Negates the magnitude modulo 2^N, like istream extraction, so "-1" gives the maximum
+            Wrap
+        };
+
+        // Matches what FromString has always done: leading whitespace is skipped, parsing stops at the first bad character,
+        // unparseable text gives 0, out of range values saturate and floating point values too small to represent give 0
+        template<class T>
+        T FromCharsSaturating(const std::string& arg, NegativeUnsigned negativeUnsigned)
+        {
+            const auto begin = arg.find_first_not_of(" \t\n\v\f\r");
+            if (begin == std::string::npos)
+                return T();
+
+            std::string_view text(arg.data() + begin, arg.size() - begin);
+            if (text.size() > 1 && text[0] == '+' && text[1] != '-')
+                text.remove_prefix(1);
+
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                if (negativeUnsigned == NegativeUnsigned::Wrap && text[0] == '-')
+                {
+                    T magnitude = T();
+                    const auto [parsedEnd, error] = std::from_chars(text.data() + 1, text.data() + text.size(), magnitude);
+                    if (error == std::errc())
+                        return static_cast<T>(T() - magnitude);
+                    return error == std::errc::result_out_of_range ? std::numeric_limits<T>::max() : T();
+                }
+            }
+
+            T value = T();
+            const auto [parsedEnd, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (error == std::errc())
+                return value;
+            else if (error != std::errc::result_out_of_range)
+                return T();
+
+            const auto negative = text[0] == '-';
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                if (!IsFloatOverflow(std::string_view(text.data(), parsedEnd - text.data())))
+                    return negative ? -T() : T();
+            }
+
+            return negative ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+        }
+    }
+
+    // Upper bound on the characters ToChars writes for a T, in every format except FloatFormat::Fixed
+    template<class T>
+    constexpr size_t MaxChars = detail::MaxChars<T>();
+
+    // Upper bound for FloatFormat::Fixed, which spells out every digit of very large and very small values
+    template<class T>
+    constexpr size_t MaxFixedChars = detail::MaxFixedChars<T>();
+
+    // Floating point layouts, all with as few significant digits as still read back to the same value
+    enum class FloatFormat
+    {
+        // Never an exponent
+        Fixed,
+        // Always an exponent
+        Scientific,
+        // Like printf's %g: an exponent only for very large or very small values
+        General
+    };
+
+    // Writes value into [begin, end) with std::to_chars; floating point values use the shortest round-trip form
+    // Returns one past the last character written, or nullptr if the buffer is too small
+    template<class T>
+    [[nodiscard]] char* ToChars(char* begin, char* end, T value)
+    {
+        static_assert(detail::IsCharConvertible<T>, "ToChars requires an integral or floating point type.");
+
+        const auto [written, error] = std::to_chars(begin, end, value);
+        return error == std::errc() ? written : nullptr;
+    }
+
+    template<class T>
+    [[nodiscard]] char* ToChars(char* begin, char* end, T value, FloatFormat format)
+    {
+        static_assert(std::is_floating_point_v<T>, "ToChars with a FloatFormat requires a floating point type.");
+
+        const auto charsFormat = format == FloatFormat::Fixed
+            ? std::chars_format::fixed
+            : format == FloatFormat::Scientific
+                ? std::chars_format::scientific
+                : std::chars_format::general;
+        const auto [written, error] = std::to_chars(begin, end, value, charsFormat);
+        return error == std::errc() ? written : nullptr;
+    }
+
+    template<class T>
+    void AppendChars(std::string& output, T value)
+    {
+        char buffer[MaxChars<T>];
+        output.append(buffer, ToChars(buffer, buffer + MaxChars<T>, value));
+    }
+
+    template<class T>
+    void AppendChars(std::string& output, T value, FloatFormat format)
+    {
+        if (format == FloatFormat::Fixed)
+        {
+            char buffer[MaxFixedChars<T>];
+            output.append(buffer, ToChars(buffer, buffer + MaxFixedChars<T>, value, format));
+        }
+        else
+        {
+            char buffer[MaxChars<T>];
+            output.append(buffer, ToChars(buffer, buffer + MaxChars<T>, value, format));
+        }
+    }
+
+    namespace detail
+    {
+        // What ToString gives a number, written to buffer, which needs room for MaxChars<T>
+        // StringBuilder and Format write numbers through this too so they all agree
+        template<class T>
+        char* NumberToChars(char* buffer, T arg)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                // Laid out like a default formatted stream, but with every digit needed to read back the same value
+                return ToChars(buffer, buffer + ::Chroma::MaxChars<T>, arg, FloatFormat::General);
+            else
+                return ToChars(buffer, buffer + ::Chroma::MaxChars<T>, arg);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "CharacterSet.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CHROMA_CHARACTER_SET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Chroma
+{
+    namespace
+    {
+#if defined(CHROMA_CHARACTER_SET_SSE2)
+        // Bit i is set when byte i of the block is one of the members
+        unsigned int MemberMask(__m128i block, const char* members, size_t memberCount)
+        {
+            auto matches = _mm_setzero_si128();
+            for (size_t i = 0; i < memberCount; ++i)
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(members[i])));
+            return static_cast<unsigned int>(_mm_movemask_epi8(matches));
+        }
+
+        template<bool in>
+        size_t FindVector(std::string_view string, size_t& position, const char* members, size_t memberCount)
+        {
+            constexpr size_t width = 16;
+            for (; position + width <= string.size(); position += width)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + position));
+                auto mask = MemberMask(block, members, memberCount);
+                if constexpr (!in)
+                    mask = ~mask & 0xFFFF;
+                if (mask != 0)
+                    return position + std::countr_zero(mask);
+            }
+
+            return std::string_view::npos;
+        }
+
+        // Walks blocks backward from end, which is lowered to where the scalar tail should pick up
+        size_t FindLastNotInVector(std::string_view string, size_t& end, const char* members, size_t memberCount)
+        {
+            constexpr size_t width = 16;
+            for (; end >= width; end -= width)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + end - width));
+                const auto mask = ~MemberMask(block, members, memberCount) & 0xFFFF;
+                if (mask != 0)
+                    return end - width + std::bit_width(mask) - 1;
+            }
+
+            return std::string_view::npos;
+        }
+#endif
+    }
+
+    size_t CharacterSet::FindFirstIn(std::string_view string, size_t from) const
+    {
+        auto position = from;
+#if defined(CHROMA_CHARACTER_SET_SSE2)
+        if (size > 0 && size <= maxVectorMembers)
+        {
+            const auto found = FindVector<true>(string, position, members.data(), size);
+            if (found != std::string_view::npos)
+                return found;
+        }
+#endif
+        for (; position < string.size(); ++position)
+            if (Contains(string[position]))
+                return position;
+
+        return std::string_view::npos;
+    }
+
+    size_t CharacterSet::FindFirstNotIn(std::string_view string, size_t from) const
+    {
+        auto position = from;
+#if defined(CHROMA_CHARACTER_SET_SSE2)
+        if (size > 0 && size <= maxVectorMembers)
+        {
+            const auto found = FindVector<false>(string, position, members.data(), size);
+            if (found != std::string_view::npos)
+                return found;
+        }
+#endif
+        for (; position < string.size(); ++position)
+            if (!Contains(string[position]))
+                return position;
+
+        return std::string_view::npos;
+    }
+
+    size_t CharacterSet::FindLastNotIn(std::string_view string) const
+    {
+        auto end = string.size();
+#if defined(CHROMA_CHARACTER_SET_SSE2)
+        if (size > 0 && size <= maxVectorMembers)
+        {
+            const auto found = FindLastNotInVector(string, end, members.data(), size);
+            if (found != std::string_view::npos)
+                return found;
+        }
+#endif
+        while (end > 0)
+        {
+            --end;
+            if (!Contains(string[end]))
+                return end;
+        }
+
+        return std::string_view::npos;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string_view>
+#include <array>
+#include <cstdint>
+
+namespace Chroma
+{
+    // Set of byte values, checked with a 256 bit table
+    class CharacterSet
+    {
+    public:
+        constexpr CharacterSet() = default;
+        constexpr CharacterSet(std::string_view characters);
+
+        constexpr void Add(char character);
+        [[nodiscard]] constexpr bool Contains(char character) const;
+        [[nodiscard]] constexpr size_t Size() const;
+
+        // Position of the first character at or after from that is in the set, or npos
+        [[nodiscard]] size_t FindFirstIn(std::string_view string, size_t from = 0) const;
+        // Position of the first character at or after from that is not in the set, or npos
+        [[nodiscard]] size_t FindFirstNotIn(std::string_view string, size_t from = 0) const;
+        // Position of the last character that is not in the set, or npos
+        [[nodiscard]] size_t FindLastNotIn(std::string_view string) const;
+    private:
+        std::array<std::uint64_t, 4> bits = {};
+        size_t size = 0;
+
+        // Small sets also keep their members so that searches can compare against each one in parallel
+        static constexpr size_t maxVectorMembers = 8;
+        std::array<char, maxVectorMembers> members = {};
+    };
+
+    constexpr CharacterSet::CharacterSet(std::string_view characters)
+    {
+        for (auto character : characters)
+            Add(character);
+    }
+
+    constexpr void CharacterSet::Add(char character)
+    {
+        if (Contains(character))
+            return;
+
+        const auto byte = static_cast<std::uint8_t>(character);
+        bits[byte / 64] |= std::uint64_t(1) << (byte % 64);
+        if (size < maxVectorMembers)
+            members[size] = character;
+        ++size;
+    }
+
+    constexpr bool CharacterSet::Contains(char character) const
+    {
+        const auto byte = static_cast<std::uint8_t>(character);
+        return (bits[byte / 64] >> (byte % 64)) & 1;
+    }
+
+    constexpr size_t CharacterSet::Size() const
+    {
+        return size;
+    }
+
+    // Space, tab, newline, carriage return, vertical tab and form feed
+    inline constexpr CharacterSet whitespace(" \t\n\r\v\f");
+}
\ No newline at end of file
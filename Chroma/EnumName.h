@@ -0,0 +1,196 @@
+#pragma once
+
+#include <string_view>
+#include <array>
+#include <optional>
+#include <utility>
+#include <type_traits>
+#include <bit>
+#include <cstdint>
+
+#include "Enum.h"
+
+namespace Chroma
+{
+    // Specialize for an enum to give it names, deriving from the EnumIterationTraits that covers its enumerators:
+    //     template<> struct EnumNameTraits<Color> : EnumIterationTraits<Color, Color::Red, Color::Count> {};
+    // Values from min up to but not including max are named, as with EnumIterationTraits::ToTuple
+    template<class Enum>
+    struct EnumNameTraits;
+
+    namespace detail
+    {
+        template<class Enum>
+        concept HasEnumNames = std::is_enum_v<Enum> && requires { EnumNameTraits<Enum>::minU; EnumNameTraits<Enum>::maxU; };
+
+        // Picks the enumerator's name out of the compiler's signature for RawEnumName; values without an enumerator print as casts
+        constexpr std::string_view EnumNameFromSignature(std::string_view signature)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            constexpr std::string_view open = "RawEnumName<";
+            constexpr std::string_view close = ">(void)";
+            const auto begin = signature.find(open) + open.size();
+            const auto end = signature.rfind(close);
+#else
+            constexpr std::string_view open = "value = ";
+            const auto begin = signature.find(open) + open.size();
+            const auto end = signature.find_first_of(";]", begin);
+#endif
+            const auto text = signature.substr(begin, end - begin);
+            // Values without an enumerator print as casts like (E)5, which leave a number after the last parenthesis
+            // A parenthesis alone doesn't mean that, since Clang qualifies enumerators in anonymous namespaces with (anonymous namespace)::
+            const auto qualifier = text.find_last_of(":)");
+            const auto name = qualifier == std::string_view::npos ? text : text.substr(qualifier + 1);
+            if (name.empty() || (name.front() >= '0' && name.front() <= '9') || name.front() == '-')
+                return {};
+            return name;
+        }
+
+        template<auto value>
+        constexpr std::string_view RawEnumName()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return EnumNameFromSignature(__FUNCSIG__);
+#else
+            return EnumNameFromSignature(__PRETTY_FUNCTION__);
+#endif
+        }
+
+        // Copies the name out of the signature so the tables don't point into it
+        template<auto value>
+        struct EnumNameStorage
+        {
+            static constexpr std::string_view raw = RawEnumName<value>();
+            static constexpr auto text = []()
+            {
+                std::array<char, raw.size() + 1> text = {};
+                for (size_t i = 0; i < raw.size(); ++i)
+                    text[i] = raw[i];
+                return text;
+            }();
+            static constexpr std::string_view name = std::string_view(text.data(), raw.size());
+        };
+
+        constexpr std::uint64_t EnumNameHash(std::string_view name, std::uint64_t seed)
+        {
+            auto hash = 0xCBF29CE484222325 ^ (seed * 0x9E3779B97F4A7C15);
+            for (auto character : name)
+                hash = (hash ^ static_cast<unsigned char>(character)) * 0x100000001B3;
+            return hash ^ (hash >> 32);
+        }
+
+        // Hash and displace: names are hashed into buckets, then each bucket gets the seed that puts all its names in free slots
+        template<size_t count>
+        struct EnumPerfectHash
+        {
+            static constexpr size_t slotCount = std::bit_ceil(count * 2 + 1);
+            static constexpr size_t bucketCount = slotCount / 4 + 1;
+
+            std::array<std::uint64_t, bucketCount> seeds = {};
+            // Index of the name plus one, or 0 for an empty slot
+            std::array<std::uint32_t, slotCount> slots = {};
+
+            constexpr explicit EnumPerfectHash(const std::array<std::string_view, count>& names)
+            {
+                std::array<size_t, count> bucketOf = {};
+                std::array<size_t, bucketCount> bucketSizes = {};
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (names[i].empty())
+                        continue;
+                    bucketOf[i] = EnumNameHash(names[i], 0) % bucketCount;
+                    ++bucketSizes[bucketOf[i]];
+                }
+
+                // Fullest buckets first, while there is the most room
+                std::array<bool, bucketCount> placed = {};
+                for (size_t round = 0; round < bucketCount; ++round)
+                {
+                    size_t bucket = 0;
+                    for (size_t i = 0; i < bucketCount; ++i)
+                        if (!placed[i] && (placed[bucket] || bucketSizes[i] > bucketSizes[bucket]))
+                            bucket = i;
+                    placed[bucket] = true;
+                    if (bucketSizes[bucket] == 0)
+                        continue;
+
+                    for (std::uint64_t seed = 1;; ++seed)
+                    {
+                        std::array<size_t, count> taken = {};
+                        size_t takenCount = 0;
+                        auto fits = true;
+                        for (size_t i = 0; i < count && fits; ++i)
+                        {
+                            if (names[i].empty() || bucketOf[i] != bucket)
+                                continue;
+
+                            const auto slot = EnumNameHash(names[i], seed) % slotCount;
+                            fits = slots[slot] == 0;
+                            for (size_t j = 0; j < takenCount && fits; ++j)
+                                fits = taken[j] != slot;
+                            taken[takenCount++] = slot;
+                        }
+
+                        if (!fits)
+                            continue;
+
+                        seeds[bucket] = seed;
+                        for (size_t i = 0; i < count; ++i)
+                            if (!names[i].empty() && bucketOf[i] == bucket)
+                                slots[EnumNameHash(names[i], seed) % slotCount] = static_cast<std::uint32_t>(i + 1);
+                        break;
+                    }
+                }
+            }
+
+            // Index of name, or count if it isn't one of names
+            [[nodiscard]] constexpr size_t Find(std::string_view name, const std::array<std::string_view, count>& names) const
+            {
+                const auto bucket = EnumNameHash(name, 0) % bucketCount;
+                const auto slot = slots[EnumNameHash(name, seeds[bucket]) % slotCount];
+                return slot != 0 && names[slot - 1] == name ? slot - 1 : count;
+            }
+        };
+
+        template<class Enum>
+        struct EnumNameTable
+        {
+            using Traits = EnumNameTraits<Enum>;
+            using Underlying = typename std::underlying_type<Enum>::type;
+
+            static constexpr Underlying first = Traits::minU;
+            static constexpr size_t count = static_cast<size_t>(Traits::maxU - Traits::minU);
+
+            template<size_t... indices>
+            static constexpr std::array<std::string_view, count> MakeNames(std::index_sequence<indices...>)
+            {
+                return { EnumNameStorage<static_cast<Enum>(first + static_cast<Underlying>(indices))>::name... };
+            }
+
+            static constexpr auto names = MakeNames(std::make_index_sequence<count>());
+            static constexpr auto hash = EnumPerfectHash<count>(names);
+        };
+    }
+
+    // Name of value, or an empty view if it has no enumerator or is outside EnumNameTraits<Enum>
+    template<detail::HasEnumNames Enum>
+    [[nodiscard]] constexpr std::string_view EnumName(Enum value)
+    {
+        using Table = detail::EnumNameTable<Enum>;
+        const auto index = static_cast<typename Table::Underlying>(value) - Table::first;
+        if (static_cast<typename Table::Underlying>(value) < Table::first || static_cast<size_t>(index) >= Table::count)
+            return {};
+        return Table::names[static_cast<size_t>(index)];
+    }
+
+    // Enumerator named exactly name, found with a single probe of a perfect hash built at compile time
+    template<detail::HasEnumNames Enum>
+    [[nodiscard]] constexpr std::optional<Enum> EnumFromName(std::string_view name)
+    {
+        using Table = detail::EnumNameTable<Enum>;
+        const auto index = Table::hash.Find(name, Table::names);
+        if (index == Table::count)
+            return std::nullopt;
+        return static_cast<Enum>(Table::first + static_cast<typename Table::Underlying>(index));
+    }
+}
\ No newline at end of file
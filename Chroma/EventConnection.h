@@ -107,6 +107,6 @@ namespace Chroma
 
     template<class... Args>
     EventConnection<Args...>::EventConnection(iterator itr, EventT& owner) :
-        itr(new iterator(itr)), owner(new EventT*(&owner))
+        itr(std::make_shared<iterator>(itr)), owner(std::make_shared<EventT*>(&owner))
     {}
 }
\ No newline at end of file
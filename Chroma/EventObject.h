@@ -3,8 +3,11 @@
 #include <vector>
 #include <list>
 #include <functional>
+#include <memory>
+#include <tuple>
 
 #include "Function.h"
+#include "Strand.h"
 
 namespace Chroma
 {
@@ -17,6 +20,7 @@ namespace Chroma
     public:
         using FunctionT = std::function<void(Args...)>;
         using Connection = EventConnection<Args...>;
+        using ConnectionBatch = std::vector<Connection>;
     public:
         Event();
         Event(const Event &arg);
@@ -36,8 +40,18 @@ namespace Chroma
         Connection Subscribe(Ret(Obj::*func)(Args...) const, const Obj& obj);
         Connection Subscribe(const FunctionT& function);
         Connection Subscribe(FunctionT&& function);
+        // Equivalent to subscribing each function in order, but links all slots in one splice
+        template<class Iterator>
+        ConnectionBatch SubscribeMany(Iterator begin, Iterator end);
+        ConnectionBatch SubscribeMany(std::vector<FunctionT>&& functions);
+        // Executing the event posts the call to the strand instead of running it inline
+        // Arguments are copied, or moved if passed by value or rvalue reference, so they outlive the emission
+        // A slot taking an lvalue reference gets a reference to that copy, not to the caller's object
+        // The strand is held by reference, so it must outlive the slot: sever the connection or destroy the event first
+        Connection SubscribeAsync(FunctionT function, Strand& strand);
 
         void Remove(Connection& remove);
+        void RemoveMany(ConnectionBatch& remove);
         void Clear();
         [[nodiscard]] bool IsEmpty() const;
     private:
@@ -56,6 +70,8 @@ namespace Chroma
         [[nodiscard]] size_t FindNextOffset() const;
         // Sets the next iterator by an offset from the beginning of the list
         void SkipNext(size_t offset);
+        // Unlinks the connection's slot, moving the next iterator off it if an execution is in progress
+        void Erase(Connection& remove);
 
         void SetupConnectionsMove(Event &&arg);
         void SetupConnectionsCopy(const Event &arg);
@@ -172,17 +188,78 @@ namespace Chroma
         return connections.back();
     }
 
+    template<class... Args>
+    typename Event<Args...>::Connection Event<Args...>::SubscribeAsync(FunctionT function, Strand& strand)
+    {
+        auto shared = std::make_shared<FunctionT>(std::move(function));
+        return Subscribe(FunctionT([shared, &strand](Args ... args)
+        {
+            // Held by shared_ptr so move-only arguments still leave the task copyable
+            auto arguments = std::make_shared<std::tuple<std::decay_t<Args>...>>(std::forward<Args>(args)...);
+            strand.Post([shared, arguments]()
+            {
+                std::apply([&shared](auto& ... unpacked) { (*shared)(std::forward<Args>(unpacked)...); }, *arguments);
+            });
+        }));
+    }
+
     template<class... Args>
     void Event<Args...>::Remove(Connection& remove)
     {
         if (slots.empty() || !remove.IsValid() || *remove.owner != this)
             return;
 
-        next = slots.erase(*remove.itr);
-        connections.erase(remove.connectionItr);
+        Erase(remove);
+    }
 
-        *remove.itr = slots.end();
-        *remove.owner = nullptr;
+    template<class... Args>
+    template<class Iterator>
+    typename Event<Args...>::ConnectionBatch Event<Args...>::SubscribeMany(Iterator begin, Iterator end)
+    {
+        Slots batchSlots;
+        for (auto loop = begin; loop != end; ++loop)
+            batchSlots.push_front(FunctionT(*loop));
+
+        const auto count = batchSlots.size();
+
+        // Slots are built in isolation and spliced in so that iterators stay valid
+        // The event keeps one copy of each connection to track it, and the other is moved out to the caller
+        Connections batchConnections;
+        ConnectionBatch returnValue;
+        returnValue.reserve(count);
+        for (auto slotLoop = batchSlots.rbegin(); slotLoop != batchSlots.rend(); ++slotLoop)
+        {
+            Connection connection(std::prev(slotLoop.base()), *this);
+            batchConnections.push_back(connection);
+            connection.connectionItr = std::prev(batchConnections.end());
+            batchConnections.back().connectionItr = connection.connectionItr;
+            returnValue.push_back(std::move(connection));
+        }
+
+        slots.splice(slots.begin(), batchSlots);
+        connections.splice(connections.end(), batchConnections);
+        return returnValue;
+    }
+
+    template<class... Args>
+    typename Event<Args...>::ConnectionBatch Event<Args...>::SubscribeMany(std::vector<FunctionT>&& functions)
+    {
+        return SubscribeMany(std::make_move_iterator(functions.begin()), std::make_move_iterator(functions.end()));
+    }
+
+    template<class... Args>
+    void Event<Args...>::RemoveMany(ConnectionBatch& remove)
+    {
+        for (auto& connection : remove)
+        {
+            if (slots.empty())
+                break;
+
+            if (!connection.IsValid() || *connection.owner != this)
+                continue;
+
+            Erase(connection);
+        }
     }
 
     template<class... Args>
@@ -227,6 +304,20 @@ namespace Chroma
         }
     }
 
+    template<class... Args>
+    void Event<Args...>::Erase(Connection& remove)
+    {
+        // Only move the execution iterator when it points at the slot going away
+        if (next == *remove.itr)
+            next = slots.erase(*remove.itr);
+        else
+            slots.erase(*remove.itr);
+        connections.erase(remove.connectionItr);
+
+        *remove.itr = slots.end();
+        *remove.owner = nullptr;
+    }
+
     template<class... Args>
     void Event<Args...>::SetupConnectionsCopy(const Event &arg)
     {
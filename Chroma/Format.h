@@ -0,0 +1,192 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <array>
+#include <tuple>
+#include <type_traits>
+
+#include "StringUtility.h"
+
+namespace Chroma
+{
+    namespace detail
+    {
+        // String literal usable as a template argument, so it can be parsed at compile time
+        template<size_t N>
+        struct FormatString
+        {
+            char text[N] = {};
+
+            constexpr FormatString(const char(&string)[N])
+            {
+                for (size_t i = 0; i < N; ++i)
+                    text[i] = string[i];
+            }
+
+            [[nodiscard]] constexpr std::string_view View() const
+            {
+                return std::string_view(text, N - 1);
+            }
+        };
+
+        // Either a run of literal text or a place for the next argument
+        struct FormatSegment
+        {
+            size_t position = 0;
+            size_t size = 0;
+            bool argument = false;
+        };
+
+        // Walks format, calling literal(position, size) and argument() in order; returns false on an unmatched brace
+        template<class Literal, class Argument>
+        constexpr bool WalkFormat(std::string_view format, Literal literal, Argument argument)
+        {
+            size_t literalStart = 0;
+            for (size_t i = 0; i < format.size(); ++i)
+            {
+                const auto character = format[i];
+                if (character != '{' && character != '}')
+                    continue;
+
+                const auto next = i + 1 < format.size() ? format[i + 1] : '\0';
+                if (character == '{' && next == '}')
+                {
+                    if (i != literalStart)
+                        literal(literalStart, i - literalStart);
+                    argument();
+                }
+                else if (next == character)
+                    // Doubled braces stand for one, so keep the first and drop the second
+                    literal(literalStart, i + 1 - literalStart);
+                else
+                    return false;
+
+                literalStart = i + 2;
+                ++i;
+            }
+
+            if (literalStart < format.size())
+                literal(literalStart, format.size() - literalStart);
+            return true;
+        }
+
+        constexpr bool IsValidFormat(std::string_view format)
+        {
+            return WalkFormat(format, [](size_t, size_t) {}, []() {});
+        }
+
+        constexpr size_t FormatArgumentCount(std::string_view format)
+        {
+            size_t count = 0;
+            WalkFormat(format, [](size_t, size_t) {}, [&]() { ++count; });
+            return count;
+        }
+
+        constexpr size_t FormatSegmentCount(std::string_view format)
+        {
+            size_t count = 0;
+            WalkFormat(format, [&](size_t, size_t) { ++count; }, [&]() { ++count; });
+            return count;
+        }
+
+        template<FormatString format>
+        constexpr auto ParseFormat()
+        {
+            std::array<FormatSegment, FormatSegmentCount(format.View())> segments = {};
+            size_t count = 0;
+            WalkFormat(
+                format.View(),
+                [&](size_t position, size_t size) { segments[count++] = { position, size, false }; },
+                [&]() { segments[count++] = { 0, 0, true }; });
+            return segments;
+        }
+
+        template<FormatString format>
+        constexpr size_t FormatLiteralSize()
+        {
+            size_t size = 0;
+            for (auto& segment : ParseFormat<format>())
+                size += segment.size;
+            return size;
+        }
+
+        template<class T>
+        struct FormattedNumber
+        {
+            char buffer[::Chroma::MaxChars<T>];
+            size_t size;
+
+            explicit FormattedNumber(T arg) : size(NumberToChars(buffer, arg) - buffer)
+            {}
+
+            [[nodiscard]] std::string_view View() const
+            {
+                return std::string_view(buffer, size);
+            }
+        };
+
+        // Turns an argument into something holding its text, converting it exactly once
+        template<class T>
+        auto PrepareFormatArgument(const T& arg)
+        {
+            if constexpr (IsCharConvertible<T>)
+                return FormattedNumber<T>(arg);
+            else if constexpr (std::is_same_v<T, bool>)
+                return std::string_view(arg ? "true" : "false");
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+                return std::string_view(arg);
+            else
+                return ToString(arg);
+        }
+
+        template<class T>
+        std::string_view FormattedView(const FormattedNumber<T>& prepared)
+        {
+            return prepared.View();
+        }
+
+        inline std::string_view FormattedView(std::string_view prepared)
+        {
+            return prepared;
+        }
+    }
+
+    // Appends format to output with each {} replaced by the next argument, as ToString would write it; {{ and }} stand for braces
+    // The format is parsed and checked against the arguments at compile time, and output grows at most once
+    template<detail::FormatString format, class... Args>
+    void FormatTo(std::string& output, const Args&... args)
+    {
+        static_assert(detail::IsValidFormat(format.View()), "Format has a { or } that is neither {} nor doubled.");
+        static_assert(detail::FormatArgumentCount(format.View()) == sizeof...(Args), "Format needs exactly one argument per {}.");
+
+        constexpr auto segments = detail::ParseFormat<format>();
+        const auto prepared = std::make_tuple(detail::PrepareFormatArgument(args)...);
+        const auto views = std::apply(
+            [](const auto&... argument) { return std::array<std::string_view, sizeof...(Args)>{ detail::FormattedView(argument)... }; },
+            prepared);
+
+        auto size = output.size() + detail::FormatLiteralSize<format>();
+        for (auto view : views)
+            size += view.size();
+        output.reserve(size);
+
+        const auto text = format.View();
+        size_t nextArgument = 0;
+        for (auto& segment : segments)
+        {
+            if (segment.argument)
+                output.append(views[nextArgument++]);
+            else
+                output.append(text.substr(segment.position, segment.size));
+        }
+    }
+
+    template<detail::FormatString format, class... Args>
+    [[nodiscard]] std::string Format(const Args&... args)
+    {
+        std::string output;
+        FormatTo<format>(output, args...);
+        return output;
+    }
+}
\ No newline at end of file
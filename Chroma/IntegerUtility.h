@@ -1,11 +1,160 @@
 #pragma once
 
+#include <type_traits>
+#include <limits>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <span>
+#include <bit>
+#include <array>
+#include <ranges>
+#include <cstdint>
+
 namespace Chroma
 {
-    template<class T>
-    T Digits(T of)
+    namespace detail
+    {
+        // The types std::in_range and std::cmp_less accept, which leaves out characters and bool
+        template<class T>
+        constexpr bool IsStandardInteger =
+            std::is_integral_v<T> &&
+            !std::is_same_v<std::remove_cv_t<T>, bool> &&
+            !std::is_same_v<std::remove_cv_t<T>, char> &&
+            !std::is_same_v<std::remove_cv_t<T>, wchar_t> &&
+            !std::is_same_v<std::remove_cv_t<T>, char8_t> &&
+            !std::is_same_v<std::remove_cv_t<T>, char16_t> &&
+            !std::is_same_v<std::remove_cv_t<T>, char32_t>;
+
+        inline constexpr std::array<std::uint64_t, 20> powersOf10 = []()
+        {
+            std::array<std::uint64_t, 20> powers = {};
+            std::uint64_t power = 1;
+            for (auto& entry : powers)
+            {
+                entry = power;
+                power *= 10;
+            }
+            return powers;
+        }();
+
+        template<class T>
+        constexpr auto Magnitude(T of)
+        {
+            using Unsigned = typename std::make_unsigned<T>::type;
+            const auto bits = static_cast<Unsigned>(of);
+            if constexpr (std::is_signed_v<T>)
+                return of < 0 ? static_cast<Unsigned>(Unsigned(0) - bits) : bits;
+            else
+                return bits;
+        }
+    }
+
+    // of must be positive
+    template<class T, typename std::enable_if<std::is_integral_v<T> && !std::is_same_v<T, bool>, int>::type = 0>
+    [[nodiscard]] constexpr T Log2(T of)
+    {
+        return static_cast<T>(std::bit_width(detail::Magnitude(of)) - 1);
+    }
+
+    // of must be positive
+    template<class T, typename std::enable_if<std::is_integral_v<T> && !std::is_same_v<T, bool>, int>::type = 0>
+    [[nodiscard]] constexpr T Log10(T of)
+    {
+        const auto magnitude = static_cast<std::uint64_t>(detail::Magnitude(of));
+        // 1233 / 4096 is just over log10(2), which puts this at the answer or one above it
+        const auto estimate = (std::bit_width(magnitude) * 1233) >> 12;
+        return static_cast<T>(estimate - (magnitude < detail::powersOf10[estimate]));
+    }
+
+    // Decimal digits in of, not counting a minus sign
+    template<class T, typename std::enable_if<std::is_integral_v<T> && !std::is_same_v<T, bool>, int>::type = 0>
+    [[nodiscard]] constexpr T Digits(T of)
+    {
+        // Setting the lowest bit gives 0 one digit and never moves anything else past a power of ten
+        return static_cast<T>(Log10(detail::Magnitude(of) | 1) + 1);
+    }
+
+    // Clamps value to To's range
+    template<class To, class From>
+    [[nodiscard]] constexpr To SaturatingCast(From value)
+    {
+        static_assert(detail::IsStandardInteger<To> && detail::IsStandardInteger<From>, "SaturatingCast requires integer types other than characters and bool.");
+
+        constexpr auto min = std::numeric_limits<To>::min();
+        constexpr auto max = std::numeric_limits<To>::max();
+        if constexpr (std::in_range<From>(min) && std::in_range<From>(max))
+            // Clamping in the wider type compiles to min and max instructions, which vectorize
+            return static_cast<To>(std::clamp(value, static_cast<From>(min), static_cast<From>(max)));
+        else if (std::cmp_less(value, min))
+            return min;
+        else if (std::cmp_greater(value, max))
+            return max;
+        else
+            return static_cast<To>(value);
+    }
+
+    // Empty if value doesn't fit in To
+    template<class To, class From>
+    [[nodiscard]] constexpr std::optional<To> CheckedCast(From value)
     {
-        const auto division = of / 10;
-        return division == 0 ? 1 : 1 + Digits(division);
+        static_assert(detail::IsStandardInteger<To> && detail::IsStandardInteger<From>, "CheckedCast requires integer types other than characters and bool.");
+
+        if (!std::in_range<To>(value))
+            return std::nullopt;
+        return static_cast<To>(value);
+    }
+
+    // Batch versions write output[i] for each input[i]; output needs at least input.size() elements
+    // input and output are any contiguous ranges, such as vectors, arrays and spans
+    // The loops are kept free of branches and early exits so the compiler can vectorize them
+
+    template<std::ranges::contiguous_range Input, std::ranges::contiguous_range Output>
+    void Digits(const Input& input, Output&& output)
+    {
+        using T = std::ranges::range_value_t<Input>;
+        const std::span<const T> from(input);
+        const std::span<T> to(output);
+        for (size_t i = 0; i < from.size(); ++i)
+            to[i] = Digits(from[i]);
+    }
+
+    template<class To, std::ranges::contiguous_range Input, std::ranges::contiguous_range Output>
+    void SaturatingCast(const Input& input, Output&& output)
+    {
+        using From = std::ranges::range_value_t<Input>;
+        const std::span<const From> from(input);
+        const std::span<To> to(output);
+        for (size_t i = 0; i < from.size(); ++i)
+            to[i] = SaturatingCast<To>(from[i]);
+    }
+
+    // Returned by the batch CheckedCast when every value fits
+    inline constexpr size_t allCastsFit = static_cast<size_t>(-1);
+
+    // Returns the position of the first value that doesn't fit in To, or allCastsFit if they all do
+    // Values that don't fit are written truncated
+    template<class To, std::ranges::contiguous_range Input, std::ranges::contiguous_range Output>
+    size_t CheckedCast(const Input& input, Output&& output)
+    {
+        using From = std::ranges::range_value_t<Input>;
+        static_assert(detail::IsStandardInteger<To> && detail::IsStandardInteger<From>, "CheckedCast requires integer types other than characters and bool.");
+
+        const std::span<const From> from(input);
+        const std::span<To> to(output);
+        auto allFit = true;
+        for (size_t i = 0; i < from.size(); ++i)
+        {
+            allFit &= std::in_range<To>(from[i]);
+            to[i] = static_cast<To>(from[i]);
+        }
+
+        if (allFit)
+            return allCastsFit;
+
+        for (size_t i = 0; i < from.size(); ++i)
+            if (!std::in_range<To>(from[i]))
+                return i;
+        return allCastsFit;
     }
 }
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "MappedFile.h"
+
+#include <utility>
+
+#include "DetailedException.h"
+#include "Unicode.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Chroma
+{
+    namespace
+    {
+        // Converting the path mustn't throw from inside error handling, which path.string() can for unrepresentable paths
+        std::string PathText(const std::filesystem::path& path)
+        {
+#ifdef _WIN32
+            // An unpaired surrogate cuts the text short; no UTF-16 code unit takes more than 3 bytes
+            const std::u16string_view wide(reinterpret_cast<const char16_t*>(path.native().data()), path.native().size());
+            std::string text(wide.size() * 3, '\0');
+            text.resize(Utf16ToUtf8(wide, text.data()).written);
+            return text;
+#else
+            return path.native();
+#endif
+        }
+
+        [[noreturn]] void ThrowMappingError(const std::string& message, const std::filesystem::path& path)
+        {
+            throw DetailedException(message, { { "Path", PathText(path) } });
+        }
+    }
+
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::filesystem::path& path, Access access)
+    {
+        const DWORD flags = access == Access::Sequential
+            ? FILE_FLAG_SEQUENTIAL_SCAN
+            : access == Access::Random ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL;
+        const auto openedFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+        if (openedFile == INVALID_HANDLE_VALUE)
+            ThrowMappingError("Could not open file.", path);
+        file = openedFile;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(openedFile, &fileSize))
+        {
+            Release();
+            ThrowMappingError("Could not read file size.", path);
+        }
+
+        size = static_cast<size_t>(fileSize.QuadPart);
+        if (size == 0)
+            return;
+
+        mapping = CreateFileMappingW(openedFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            Release();
+            ThrowMappingError("Could not map file.", path);
+        }
+
+        data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!data)
+        {
+            Release();
+            ThrowMappingError("Could not map file.", path);
+        }
+    }
+
+    void MappedFile::Advise(Access access) const
+    {
+        // Normal and Random were settled by the flags the file was opened with
+        if (!data || access != Access::Sequential)
+            return;
+
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<char*>(data);
+        range.NumberOfBytes = size;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+    void MappedFile::Release()
+    {
+        if (data)
+            UnmapViewOfFile(data);
+        if (mapping)
+            CloseHandle(mapping);
+        if (file)
+            CloseHandle(file);
+
+        data = nullptr;
+        size = 0;
+        mapping = nullptr;
+        file = nullptr;
+    }
+#else
+    MappedFile::MappedFile(const std::filesystem::path& path, Access access)
+    {
+        const auto descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0)
+            ThrowMappingError("Could not open file.", path);
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0)
+        {
+            close(descriptor);
+            ThrowMappingError("Could not read file size.", path);
+        }
+
+        size = static_cast<size_t>(status.st_size);
+        if (size == 0)
+        {
+            close(descriptor);
+            return;
+        }
+
+        const auto mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        // The mapping keeps its own reference to the file
+        close(descriptor);
+        if (mapped == MAP_FAILED)
+        {
+            size = 0;
+            ThrowMappingError("Could not map file.", path);
+        }
+
+        data = static_cast<const char*>(mapped);
+        Advise(access);
+    }
+
+    void MappedFile::Advise(Access access) const
+    {
+        if (!data)
+            return;
+
+        const auto advice = access == Access::Sequential
+            ? MADV_SEQUENTIAL
+            : access == Access::Random ? MADV_RANDOM : MADV_NORMAL;
+        madvise(const_cast<char*>(data), size, advice);
+    }
+
+    void MappedFile::Release()
+    {
+        if (data)
+            munmap(const_cast<char*>(data), size);
+
+        data = nullptr;
+        size = 0;
+    }
+#endif
+
+    MappedFile::MappedFile(MappedFile&& arg) noexcept :
+        data(std::exchange(arg.data, nullptr)),
+        size(std::exchange(arg.size, 0))
+#ifdef _WIN32
+        , file(std::exchange(arg.file, nullptr)),
+        mapping(std::exchange(arg.mapping, nullptr))
+#endif
+    {}
+
+    MappedFile::~MappedFile()
+    {
+        Release();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& arg) noexcept
+    {
+        if (this == &arg)
+            return *this;
+
+        Release();
+        data = std::exchange(arg.data, nullptr);
+        size = std::exchange(arg.size, 0);
+#ifdef _WIN32
+        file = std::exchange(arg.file, nullptr);
+        mapping = std::exchange(arg.mapping, nullptr);
+#endif
+        return *this;
+    }
+
+    std::string_view MappedFile::View() const
+    {
+        return { data, size };
+    }
+
+    size_t MappedFile::Size() const
+    {
+        return size;
+    }
+
+    SplitView MappedFile::Lines() const
+    {
+        return SplitView(View(), "\n");
+    }
+
+    SplitView MappedFile::Tokens(std::string_view splitter) const
+    {
+        return SplitView(View(), splitter);
+    }
+}
\ No newline at end of file
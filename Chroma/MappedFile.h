@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string_view>
+#include <filesystem>
+
+#include "SplitView.h"
+
+namespace Chroma
+{
+    // Read only view of a whole file through the OS page cache, without copying it onto the heap
+    class MappedFile
+    {
+    public:
+        enum class Access
+        {
+            Normal,
+            // Read front to back once; the OS reads ahead aggressively and can drop pages behind the scan
+            Sequential,
+            Random
+        };
+    public:
+        // Throws DetailedException if the file can't be opened or mapped
+        explicit MappedFile(const std::filesystem::path& path, Access access = Access::Sequential);
+        MappedFile(const MappedFile& arg) = delete;
+        MappedFile(MappedFile&& arg) noexcept;
+        ~MappedFile();
+        MappedFile& operator=(const MappedFile& arg) = delete;
+        MappedFile& operator=(MappedFile&& arg) noexcept;
+
+        // Views stay valid for as long as this file is alive
+        [[nodiscard]] std::string_view View() const;
+        [[nodiscard]] size_t Size() const;
+
+        // Non-empty lines; a trailing '\r' is left on, use TrimRight to drop it
+        [[nodiscard]] SplitView Lines() const;
+        [[nodiscard]] SplitView Tokens(std::string_view splitter) const;
+
+        // Changes the read ahead hint for the whole mapping
+        // Windows fixes its hint when the file is opened, so there Sequential prefetches the mapping and the others do nothing
+        void Advise(Access access) const;
+    private:
+        const char* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        void* file = nullptr;
+        void* mapping = nullptr;
+#endif
+        void Release();
+    };
+}
\ No newline at end of file
@@ -15,4 +15,31 @@ namespace Chroma
     {
         return !(*this == arg);
     }
+
+    InternedNameValuePair::InternedNameValuePair(InternedString name, const std::string& value) :
+        name(name), value(value)
+    {}
+
+    InternedNameValuePair::InternedNameValuePair(std::string_view name, const std::string& value) :
+        name(Intern(name)), value(value)
+    {}
+
+    InternedNameValuePair::InternedNameValuePair(const NameValuePair& arg) :
+        name(Intern(arg.name)), value(arg.value)
+    {}
+
+    InternedNameValuePair::operator NameValuePair() const
+    {
+        return NameValuePair(name.String(), value);
+    }
+
+    bool InternedNameValuePair::operator==(const InternedNameValuePair& arg) const
+    {
+        return name == arg.name && value == arg.value;
+    }
+
+    bool InternedNameValuePair::operator!=(const InternedNameValuePair& arg) const
+    {
+        return !(*this == arg);
+    }
 }
\ No newline at end of file
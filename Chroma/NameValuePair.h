@@ -2,6 +2,8 @@
 
 #include <string>
 
+#include "StringPool.h"
+
 namespace Chroma
 {
     struct NameValuePair
@@ -15,4 +17,21 @@ namespace Chroma
         bool operator==(const NameValuePair& arg) const;
         bool operator!=(const NameValuePair& arg) const;
     };
+
+    // Keeps the name as a handle into the shared pool, so repeated names cost nothing to store or compare
+    struct InternedNameValuePair
+    {
+        InternedString name;
+        std::string value;
+
+        InternedNameValuePair() = default;
+        InternedNameValuePair(InternedString name, const std::string& value);
+        InternedNameValuePair(std::string_view name, const std::string& value);
+        explicit InternedNameValuePair(const NameValuePair& arg);
+
+        explicit operator NameValuePair() const;
+
+        bool operator==(const InternedNameValuePair& arg) const;
+        bool operator!=(const InternedNameValuePair& arg) const;
+    };
 }
\ No newline at end of file
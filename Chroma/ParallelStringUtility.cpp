@@ -0,0 +1,309 @@
+#include "ParallelStringUtility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <latch>
+#include <exception>
+
+#include "StringSearch.h"
+
+namespace Chroma
+{
+    namespace
+    {
+        constexpr auto npos = std::string_view::npos;
+        // Below this, splitting up the work costs more than it saves
+        constexpr size_t minimumChunkSize = 1 << 20;
+        constexpr size_t chunksPerThread = 4;
+
+        // Each chunk is the range of positions its matches can start at
+        struct Chunk
+        {
+            size_t begin;
+            size_t end;
+        };
+
+        std::vector<Chunk> MakeChunks(size_t size, WorkerPool& pool)
+        {
+            const auto count = std::max<size_t>(1, std::min(size / minimumChunkSize, pool.ThreadCount() * chunksPerThread));
+            std::vector<Chunk> chunks(count);
+            for (size_t i = 0; i < count; ++i)
+                chunks[i] = { size * i / count, size * (i + 1) / count };
+            return chunks;
+        }
+
+        // Runs work for every chunk index, doing the first on the calling thread
+        // The first exception a chunk throws is rethrown, but only once every posted chunk is done, since they all reference this frame
+        template<class Work>
+        void RunChunks(WorkerPool& pool, size_t count, Work work)
+        {
+            std::vector<std::exception_ptr> errors(count);
+            const auto run = [&work, &errors](size_t i)
+            {
+                try
+                {
+                    work(i);
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            };
+
+            std::latch done(static_cast<std::ptrdiff_t>(count - 1));
+            size_t posted = 1;
+            try
+            {
+                for (; posted < count; ++posted)
+                {
+                    pool.Post([&run, &done, i = posted]()
+                    {
+                        run(i);
+                        done.count_down();
+                    });
+                }
+            }
+            catch (...)
+            {
+                // Chunks that never reached the pool count down here so the wait can finish
+                errors[posted] = std::current_exception();
+                done.count_down(static_cast<std::ptrdiff_t>(count - posted));
+            }
+
+            if (posted == count)
+                run(0);
+            done.wait();
+
+            for (auto& error : errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+
+        // The part of input a match starting in chunk can reach
+        std::string_view Window(std::string_view input, const Chunk& chunk, size_t patternSize)
+        {
+            return input.substr(0, std::min(input.size(), chunk.end + patternSize - 1));
+        }
+
+        // Non-overlapping matches of a chunk
+        // Each chunk scans as if no match ran into it from before; stitching fixes up the ones where one did
+        struct ChunkMatches
+        {
+            std::vector<size_t> local;
+            // Matches found while fixing up, which come before local[skip...]
+            std::vector<size_t> resynced;
+            size_t skip = 0;
+
+            [[nodiscard]] size_t Count() const
+            {
+                return resynced.size() + local.size() - skip;
+            }
+
+            [[nodiscard]] size_t Last() const
+            {
+                if (skip < local.size())
+                    return local.back();
+                return resynced.empty() ? npos : resynced.back();
+            }
+
+            template<class Function>
+            void ForEach(Function function) const
+            {
+                for (auto position : resynced)
+                    function(position);
+                for (auto i = skip; i < local.size(); ++i)
+                    function(local[i]);
+            }
+        };
+
+        // Finds the same matches as searching from the start and resuming after each match
+        std::vector<ChunkMatches> FindNonOverlapping(
+            std::string_view input, const StringSearcher& searcher, const std::vector<Chunk>& chunks, WorkerPool& pool)
+        {
+            const auto patternSize = searcher.Pattern().size();
+            std::vector<ChunkMatches> matches(chunks.size());
+            RunChunks(pool, chunks.size(), [&](size_t i)
+            {
+                const auto window = Window(input, chunks[i], patternSize);
+                auto& local = matches[i].local;
+                for (auto position = searcher.Find(window, chunks[i].begin); position != npos && position < chunks[i].end; position = searcher.Find(window, position + patternSize))
+                    local.push_back(position);
+            });
+
+            // Where a match runs into the next chunk, rescan from its end until the scan lands on one of that chunk's own matches;
+            // from there the two agree
+            size_t matchedUntil = 0;
+            for (size_t i = 0; i < chunks.size(); ++i)
+            {
+                auto& chunk = matches[i];
+                if (matchedUntil > chunks[i].begin)
+                {
+                    const auto window = Window(input, chunks[i], patternSize);
+                    chunk.skip = chunk.local.size();
+                    for (auto position = searcher.Find(window, matchedUntil); position != npos && position < chunks[i].end; position = searcher.Find(window, matchedUntil))
+                    {
+                        const auto found = std::lower_bound(chunk.local.begin(), chunk.local.end(), position);
+                        if (found != chunk.local.end() && *found == position)
+                        {
+                            chunk.skip = found - chunk.local.begin();
+                            break;
+                        }
+
+                        chunk.resynced.push_back(position);
+                        matchedUntil = position + patternSize;
+                    }
+                }
+
+                if (const auto last = chunk.Last(); last != npos)
+                    matchedUntil = last + patternSize;
+            }
+
+            return matches;
+        }
+
+        // Where the last match before each chunk ends, or 0 if there is none
+        std::vector<size_t> PrecedingMatchEnds(const std::vector<ChunkMatches>& matches, size_t patternSize)
+        {
+            std::vector<size_t> ends(matches.size());
+            size_t matchedUntil = 0;
+            for (size_t i = 0; i < matches.size(); ++i)
+            {
+                ends[i] = matchedUntil;
+                if (const auto last = matches[i].Last(); last != npos)
+                    matchedUntil = last + patternSize;
+            }
+
+            return ends;
+        }
+    }
+
+    size_t CountInstances(std::string_view input, std::string_view of, WorkerPool& pool)
+    {
+        if (of.empty())
+            return input.size();
+
+        const StringSearcher searcher(of);
+        const auto chunks = MakeChunks(input.size(), pool);
+        std::vector<size_t> counts(chunks.size());
+        RunChunks(pool, chunks.size(), [&](size_t i)
+        {
+            const auto window = Window(input, chunks[i], of.size());
+            for (auto position = searcher.Find(window, chunks[i].begin); position != npos && position < chunks[i].end; position = searcher.Find(window, position + 1))
+                ++counts[i];
+        });
+
+        size_t total = 0;
+        for (auto count : counts)
+            total += count;
+        return total;
+    }
+
+    std::vector<Substring> SplitOffsets(std::string_view string, std::string_view splitter, WorkerPool& pool)
+    {
+        if (string.empty())
+            return {};
+        if (splitter.empty())
+            return { { 0, string.size() } };
+
+        const StringSearcher searcher(splitter);
+        const auto chunks = MakeChunks(string.size(), pool);
+        const auto matches = FindNonOverlapping(string, searcher, chunks, pool);
+        const auto tokenStarts = PrecedingMatchEnds(matches, splitter.size());
+
+        // Each chunk writes the tokens that end at its matches; empty tokens are skipped, so count them first
+        const auto forEachToken = [&](size_t i, auto function)
+        {
+            auto tokenStart = tokenStarts[i];
+            matches[i].ForEach([&](size_t position)
+            {
+                if (position != tokenStart)
+                    function(Substring{ tokenStart, position - tokenStart });
+                tokenStart = position + splitter.size();
+            });
+        };
+
+        std::vector<size_t> counts(chunks.size());
+        RunChunks(pool, chunks.size(), [&](size_t i)
+        {
+            forEachToken(i, [&](const Substring&) { ++counts[i]; });
+        });
+
+        std::vector<size_t> offsets(chunks.size());
+        size_t total = 0;
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            offsets[i] = total;
+            total += counts[i];
+        }
+
+        // Whatever follows the last match
+        size_t tailStart = 0;
+        for (auto chunk = matches.rbegin(); chunk != matches.rend(); ++chunk)
+        {
+            if (const auto last = chunk->Last(); last != npos)
+            {
+                tailStart = last + splitter.size();
+                break;
+            }
+        }
+
+        const auto hasTail = tailStart < string.size();
+
+        std::vector<Substring> tokens(total + hasTail);
+        RunChunks(pool, chunks.size(), [&](size_t i)
+        {
+            auto out = tokens.data() + offsets[i];
+            forEachToken(i, [&](const Substring& token) { *out++ = token; });
+        });
+
+        if (hasTail)
+            tokens.back() = { tailStart, string.size() - tailStart };
+        return tokens;
+    }
+
+    std::string ReplaceString(std::string_view string, std::string_view instance, std::string_view with, WorkerPool& pool)
+    {
+        if (instance.empty())
+            return std::string(string);
+
+        const StringSearcher searcher(instance);
+        const auto chunks = MakeChunks(string.size(), pool);
+        const auto matches = FindNonOverlapping(string, searcher, chunks, pool);
+        // Each chunk copies from its beginning, or the end of a match that ran into it, up to where the next chunk starts copying
+        const auto matchEnds = PrecedingMatchEnds(matches, instance.size());
+        std::vector<size_t> starts(chunks.size() + 1, string.size());
+        for (size_t i = 0; i < chunks.size(); ++i)
+            starts[i] = std::max(chunks[i].begin, matchEnds[i]);
+
+        // Every match before a chunk moved its output by with.size() - instance.size()
+        std::vector<size_t> outputStarts(chunks.size());
+        size_t matchesBefore = 0;
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            outputStarts[i] = starts[i] - matchesBefore * instance.size() + matchesBefore * with.size();
+            matchesBefore += matches[i].Count();
+        }
+
+        std::string output(string.size() - matchesBefore * instance.size() + matchesBefore * with.size(), '\0');
+        RunChunks(pool, chunks.size(), [&](size_t i)
+        {
+            auto out = output.data() + outputStarts[i];
+            auto copyFrom = starts[i];
+            const auto copy = [&](const char* from, size_t size)
+            {
+                std::memcpy(out, from, size);
+                out += size;
+            };
+
+            matches[i].ForEach([&](size_t position)
+            {
+                copy(string.data() + copyFrom, position - copyFrom);
+                copy(with.data(), with.size());
+                copyFrom = position + instance.size();
+            });
+            copy(string.data() + copyFrom, starts[i + 1] - copyFrom);
+        });
+
+        return output;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "WorkerPool.h"
+
+namespace Chroma
+{
+    // Part of a larger string by position, so results don't hold on to the string itself
+    struct Substring
+    {
+        size_t position = 0;
+        size_t size = 0;
+    };
+
+    // Parallel versions for very large inputs, with the same results as their single threaded counterparts
+    // The input is cut into chunks that overlap by the pattern length so matches over a boundary are found,
+    // each chunk is searched on pool, and the results are stitched into a single allocation
+    // These wait on pool, so don't call them from a task running on it
+
+    // Counts overlapping instances
+    [[nodiscard]] size_t CountInstances(std::string_view input, std::string_view of, WorkerPool& pool);
+    [[nodiscard]] std::vector<Substring> SplitOffsets(std::string_view string, std::string_view splitter, WorkerPool& pool);
+    std::string ReplaceString(std::string_view string, std::string_view instance, std::string_view with, WorkerPool& pool);
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <span>
+#include <bit>
+#include <cstring>
+#include <cstdint>
+
+#include "CharConv.h"
+#include "CharacterSet.h"
+
+namespace Chroma
+{
+    struct ParseFieldError
+    {
+        // Index of the field among all fields in the buffer
+        size_t field;
+        std::errc error;
+    };
+
+    struct ParseNumbersResult
+    {
+        // Fields written to the output; malformed fields are written as 0 so indices stay aligned
+        size_t fields = 0;
+        // Bytes of the buffer used; short of the whole buffer only when a span output fills up
+        size_t consumed = 0;
+        std::vector<ParseFieldError> errors;
+    };
+
+    namespace detail
+    {
+        // Whether all 8 bytes are ASCII digits
+        inline bool AllDigits(std::uint64_t chunk)
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+        }
+
+        // Converts 8 ASCII digits, the first in the lowest byte, by pairing them up three times
+        inline std::uint32_t ParseEightDigits(std::uint64_t chunk)
+        {
+            chunk = (chunk & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+            chunk = (chunk & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+            return static_cast<std::uint32_t>((chunk & 0x0000FFFF0000FFFF) * 42949672960001 >> 32);
+        }
+
+        template<class T>
+        FromCharsResult<T> ParseField(std::string_view field)
+        {
+            if constexpr (std::is_integral_v<T> && std::endian::native == std::endian::little)
+            {
+                auto digits = field;
+                const auto negative = !digits.empty() && digits[0] == '-';
+                if (!digits.empty() && (digits[0] == '-' || digits[0] == '+'))
+                    digits.remove_prefix(1);
+
+                // Up to 19 digits can't overflow the accumulator; anything else goes the long way
+                if (!digits.empty() && digits.size() <= 19 && (!negative || std::is_signed_v<T>))
+                {
+                    std::uint64_t magnitude = 0;
+                    size_t position = 0;
+                    bool valid = true;
+                    for (; position + 8 <= digits.size(); position += 8)
+                    {
+                        std::uint64_t chunk;
+                        std::memcpy(&chunk, digits.data() + position, sizeof(chunk));
+                        if (!AllDigits(chunk))
+                        {
+                            valid = false;
+                            break;
+                        }
+
+                        magnitude = magnitude * 100000000 + ParseEightDigits(chunk);
+                    }
+
+                    for (; valid && position < digits.size(); ++position)
+                    {
+                        const auto digit = static_cast<unsigned char>(digits[position] - '0');
+                        if (digit > 9)
+                            valid = false;
+                        else
+                            magnitude = magnitude * 10 + digit;
+                    }
+
+                    if (valid)
+                    {
+                        using Unsigned = std::make_unsigned_t<T>;
+                        const auto limit = static_cast<std::uint64_t>(static_cast<Unsigned>(std::numeric_limits<T>::max())) + (negative ? 1 : 0);
+                        if (magnitude > limit)
+                            return { T(), std::errc::result_out_of_range };
+
+                        if (negative)
+                            return { static_cast<T>(static_cast<std::int64_t>(0 - magnitude)), std::errc() };
+                        return { static_cast<T>(magnitude), std::errc() };
+                    }
+                }
+            }
+
+            return FromChars<T>(field);
+        }
+
+        template<class T, class Emit>
+        ParseNumbersResult ParseNumbers(std::string_view buffer, const CharacterSet& delimiters, size_t capacity, Emit emit)
+        {
+            ParseNumbersResult result;
+            auto position = delimiters.FindFirstNotIn(buffer);
+            while (position != std::string_view::npos && result.fields < capacity)
+            {
+                auto end = delimiters.FindFirstIn(buffer, position);
+                if (end == std::string_view::npos)
+                    end = buffer.size();
+
+                const auto parsed = ParseField<T>(buffer.substr(position, end - position));
+                if (!parsed)
+                    result.errors.push_back({ result.fields, parsed.error });
+                emit(parsed.value);
+
+                ++result.fields;
+                result.consumed = end;
+                position = delimiters.FindFirstNotIn(buffer, end);
+            }
+
+            if (position == std::string_view::npos)
+                result.consumed = buffer.size();
+
+            return result;
+        }
+    }
+
+    // Parses every field in buffer, appending one value per field to output
+    // Runs of delimiters count as a single separator
+    template<class T>
+    ParseNumbersResult ParseNumbers(std::string_view buffer, const CharacterSet& delimiters, std::vector<T>& output)
+    {
+        return detail::ParseNumbers<T>(
+            buffer,
+            delimiters,
+            std::numeric_limits<size_t>::max(),
+            [&output](T value) { output.push_back(value); });
+    }
+
+    // Parses fields in buffer until output is full; consumed says where to resume
+    template<class T>
+    ParseNumbersResult ParseNumbers(std::string_view buffer, const CharacterSet& delimiters, std::span<T> output)
+    {
+        size_t index = 0;
+        return detail::ParseNumbers<T>(
+            buffer,
+            delimiters,
+            output.size(),
+            [&output, &index](T value) { output[index++] = value; });
+    }
+}
\ No newline at end of file
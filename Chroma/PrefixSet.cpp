@@ -0,0 +1,151 @@
+#include "PrefixSet.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Chroma
+{
+    namespace detail
+    {
+        CompactTrie::CompactTrie(const std::vector<std::string>& keys)
+        {
+            // Sorted keys put every subtree in a contiguous range, so nodes can be laid out a range at a time
+            std::vector<std::uint32_t> order(keys.size());
+            std::iota(order.begin(), order.end(), std::uint32_t(0));
+            std::stable_sort(order.begin(), order.end(), [&](std::uint32_t left, std::uint32_t right) { return keys[left] < keys[right]; });
+
+            struct Pending
+            {
+                size_t begin;
+                size_t end;
+                size_t depth;
+                std::uint32_t node;
+            };
+
+            nodes.emplace_back();
+            std::vector<Pending> pending{ { 0, order.size(), 0, 0 } };
+            while (!pending.empty())
+            {
+                auto [begin, end, depth, nodeIndex] = pending.back();
+                pending.pop_back();
+
+                // Keys that end here sort first, and stable sorting keeps the earliest index of a repeated one in front
+                if (begin < end && keys[order[begin]].size() == depth)
+                {
+                    nodes[nodeIndex].match = order[begin];
+                    while (begin < end && keys[order[begin]].size() == depth)
+                        ++begin;
+                }
+
+                nodes[nodeIndex].firstEdge = static_cast<std::uint32_t>(labels.size());
+                while (begin < end)
+                {
+                    const auto label = static_cast<unsigned char>(keys[order[begin]][depth]);
+                    auto groupEnd = begin;
+                    while (groupEnd < end && static_cast<unsigned char>(keys[order[groupEnd]][depth]) == label)
+                        ++groupEnd;
+
+                    const auto child = static_cast<std::uint32_t>(nodes.size());
+                    nodes.emplace_back();
+                    labels.push_back(label);
+                    targets.push_back(child);
+                    pending.push_back({ begin, groupEnd, depth + 1, child });
+                    begin = groupEnd;
+                }
+
+                nodes[nodeIndex].edgeCount = static_cast<std::uint32_t>(labels.size()) - nodes[nodeIndex].firstEdge;
+            }
+        }
+
+        std::uint32_t CompactTrie::Child(const Node& node, unsigned char label) const
+        {
+            const auto begin = labels.begin() + node.firstEdge;
+            const auto end = begin + node.edgeCount;
+            // Most nodes have a handful of edges, where a scan beats bisecting
+            constexpr std::uint32_t scanLimit = 8;
+            auto found = node.edgeCount <= scanLimit ? std::find(begin, end, label) : std::lower_bound(begin, end, label);
+            if (found == end || *found != label)
+                return noMatch;
+            return targets[found - labels.begin()];
+        }
+    }
+
+    PrefixSet::PrefixSet(std::initializer_list<std::string_view> prefixes) :
+        prefixes(detail::CollectAffixes(prefixes)), trie(this->prefixes)
+    {}
+
+    bool PrefixSet::MatchesAny(std::string_view key) const
+    {
+        auto matches = false;
+        ForEachMatch(key, [&](size_t) { matches = true; return false; });
+        return matches;
+    }
+
+    size_t PrefixSet::LongestMatch(std::string_view key) const
+    {
+        auto longest = std::string_view::npos;
+        ForEachMatch(key, [&](size_t index) { longest = index; return true; });
+        return longest;
+    }
+
+    std::vector<size_t> PrefixSet::AllMatches(std::string_view key) const
+    {
+        std::vector<size_t> matches;
+        ForEachMatch(key, [&](size_t index) { matches.push_back(index); return true; });
+        return matches;
+    }
+
+    std::string_view PrefixSet::Prefix(size_t index) const
+    {
+        return prefixes[index];
+    }
+
+    size_t PrefixSet::Size() const
+    {
+        return prefixes.size();
+    }
+
+    SuffixSet::SuffixSet(std::initializer_list<std::string_view> suffixes) :
+        suffixes(detail::CollectAffixes(suffixes)), trie(Reversed(this->suffixes))
+    {}
+
+    bool SuffixSet::MatchesAny(std::string_view key) const
+    {
+        auto matches = false;
+        ForEachMatch(key, [&](size_t) { matches = true; return false; });
+        return matches;
+    }
+
+    size_t SuffixSet::LongestMatch(std::string_view key) const
+    {
+        auto longest = std::string_view::npos;
+        ForEachMatch(key, [&](size_t index) { longest = index; return true; });
+        return longest;
+    }
+
+    std::vector<size_t> SuffixSet::AllMatches(std::string_view key) const
+    {
+        std::vector<size_t> matches;
+        ForEachMatch(key, [&](size_t index) { matches.push_back(index); return true; });
+        return matches;
+    }
+
+    std::string_view SuffixSet::Suffix(size_t index) const
+    {
+        return suffixes[index];
+    }
+
+    size_t SuffixSet::Size() const
+    {
+        return suffixes.size();
+    }
+
+    std::vector<std::string> SuffixSet::Reversed(const std::vector<std::string>& suffixes)
+    {
+        std::vector<std::string> reversed;
+        reversed.reserve(suffixes.size());
+        for (auto& suffix : suffixes)
+            reversed.emplace_back(suffix.rbegin(), suffix.rend());
+        return reversed;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <initializer_list>
+
+namespace Chroma
+{
+    namespace detail
+    {
+        // Trie packed into flat arrays; each node's edges are contiguous and sorted by byte
+        class CompactTrie
+        {
+        public:
+            static constexpr std::uint32_t noMatch = UINT32_MAX;
+        public:
+            CompactTrie() = default;
+            // keys[i] is reported as i; a repeated key keeps its first index
+            explicit CompactTrie(const std::vector<std::string>& keys);
+
+            // Calls found(index) for every key that key starts with (or ends with, walking backwards), shortest first
+            // Stops early if found returns false
+            template<bool backwards, class Found>
+            void Walk(std::string_view key, Found found) const;
+        private:
+            struct Node
+            {
+                std::uint32_t firstEdge = 0;
+                std::uint32_t edgeCount = 0;
+                std::uint32_t match = noMatch;
+            };
+
+            std::vector<Node> nodes;
+            std::vector<unsigned char> labels;
+            std::vector<std::uint32_t> targets;
+
+            [[nodiscard]] std::uint32_t Child(const Node& node, unsigned char label) const;
+        };
+
+        template<bool backwards, class Found>
+        void CompactTrie::Walk(std::string_view key, Found found) const
+        {
+            if (nodes.empty())
+                return;
+
+            const Node* node = &nodes[0];
+            for (size_t i = 0;; ++i)
+            {
+                if (node->match != noMatch && !found(node->match))
+                    return;
+                if (i == key.size())
+                    return;
+
+                const auto label = static_cast<unsigned char>(backwards ? key[key.size() - 1 - i] : key[i]);
+                const auto child = Child(*node, label);
+                if (child == noMatch)
+                    return;
+                node = &nodes[child];
+            }
+        }
+
+        template<class Range>
+        std::vector<std::string> CollectAffixes(const Range& affixes)
+        {
+            std::vector<std::string> collected;
+            for (auto& affix : affixes)
+                collected.emplace_back(std::string_view(affix));
+            return collected;
+        }
+    }
+
+    // Set of prefixes built once and then matched against many keys, each in time proportional to the key's length
+    // Matches are reported as the index the prefix was given at
+    class PrefixSet
+    {
+    public:
+        PrefixSet() = default;
+        template<class Range>
+        explicit PrefixSet(const Range& prefixes);
+        PrefixSet(std::initializer_list<std::string_view> prefixes);
+
+        [[nodiscard]] bool MatchesAny(std::string_view key) const;
+        // Index of the longest prefix of key in the set, or npos
+        [[nodiscard]] size_t LongestMatch(std::string_view key) const;
+        // Indices of every prefix of key in the set, shortest first
+        [[nodiscard]] std::vector<size_t> AllMatches(std::string_view key) const;
+        // Calls found(index) like AllMatches without allocating; stops early if found returns false
+        template<class Found>
+        void ForEachMatch(std::string_view key, Found found) const;
+
+        [[nodiscard]] std::string_view Prefix(size_t index) const;
+        [[nodiscard]] size_t Size() const;
+    private:
+        std::vector<std::string> prefixes;
+        detail::CompactTrie trie;
+    };
+
+    // Same as PrefixSet, for suffixes
+    class SuffixSet
+    {
+    public:
+        SuffixSet() = default;
+        template<class Range>
+        explicit SuffixSet(const Range& suffixes);
+        SuffixSet(std::initializer_list<std::string_view> suffixes);
+
+        [[nodiscard]] bool MatchesAny(std::string_view key) const;
+        // Index of the longest suffix of key in the set, or npos
+        [[nodiscard]] size_t LongestMatch(std::string_view key) const;
+        // Indices of every suffix of key in the set, shortest first
+        [[nodiscard]] std::vector<size_t> AllMatches(std::string_view key) const;
+        template<class Found>
+        void ForEachMatch(std::string_view key, Found found) const;
+
+        [[nodiscard]] std::string_view Suffix(size_t index) const;
+        [[nodiscard]] size_t Size() const;
+    private:
+        std::vector<std::string> suffixes;
+        detail::CompactTrie trie;
+
+        [[nodiscard]] static std::vector<std::string> Reversed(const std::vector<std::string>& suffixes);
+    };
+
+    template<class Range>
+    PrefixSet::PrefixSet(const Range& prefixes) :
+        prefixes(detail::CollectAffixes(prefixes)), trie(this->prefixes)
+    {}
+
+    template<class Found>
+    void PrefixSet::ForEachMatch(std::string_view key, Found found) const
+    {
+        trie.Walk<false>(key, [&](std::uint32_t index) { return found(static_cast<size_t>(index)); });
+    }
+
+    template<class Range>
+    SuffixSet::SuffixSet(const Range& suffixes) :
+        suffixes(detail::CollectAffixes(suffixes)), trie(Reversed(this->suffixes))
+    {}
+
+    template<class Found>
+    void SuffixSet::ForEachMatch(std::string_view key, Found found) const
+    {
+        trie.Walk<true>(key, [&](std::uint32_t index) { return found(static_cast<size_t>(index)); });
+    }
+}
\ No newline at end of file
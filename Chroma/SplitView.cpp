@@ -0,0 +1,285 @@
+#include "SplitView.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "StringSearch.h"
+
+namespace Chroma
+{
+    auto SplitView::iterator::operator*() const -> reference
+    {
+        return token;
+    }
+
+    auto SplitView::iterator::operator->() const -> pointer
+    {
+        return &token;
+    }
+
+    auto SplitView::iterator::operator++() -> iterator&
+    {
+        Advance();
+        return *this;
+    }
+
+    auto SplitView::iterator::operator++(int) -> iterator
+    {
+        auto copy = *this;
+        Advance();
+        return copy;
+    }
+
+    bool SplitView::iterator::operator==(const iterator& arg) const
+    {
+        return owner == arg.owner && (!owner || token.data() == arg.token.data());
+    }
+
+    bool SplitView::iterator::operator!=(const iterator& arg) const
+    {
+        return !(*this == arg);
+    }
+
+    SplitView::iterator::iterator(const SplitView& owner) : owner(&owner)
+    {
+        Advance();
+    }
+
+    void SplitView::iterator::Advance()
+    {
+        const auto string = owner->string;
+        const auto splitter = owner->splitter;
+        while (position < string.size())
+        {
+            const auto found = splitter.empty()
+                ? std::string_view::npos
+                : FindInstance(string, splitter, position);
+            const auto tokenEnd = found == std::string_view::npos ? string.size() : found;
+            const auto tokenStart = position;
+            position = found == std::string_view::npos ? string.size() : found + splitter.size();
+
+            // Empty tokens are skipped, as Split does
+            if (tokenEnd != tokenStart)
+            {
+                token = string.substr(tokenStart, tokenEnd - tokenStart);
+                return;
+            }
+        }
+
+        owner = nullptr;
+        token = {};
+    }
+
+    SplitView::SplitView(std::string_view string, std::string_view splitter) :
+        string(string), splitter(splitter)
+    {}
+
+    auto SplitView::begin() const -> iterator
+    {
+        return iterator(*this);
+    }
+
+    auto SplitView::end() const -> iterator
+    {
+        return iterator();
+    }
+
+    auto SplitAnyView::iterator::operator*() const -> reference
+    {
+        return token;
+    }
+
+    auto SplitAnyView::iterator::operator->() const -> pointer
+    {
+        return &token;
+    }
+
+    auto SplitAnyView::iterator::operator++() -> iterator&
+    {
+        Advance();
+        return *this;
+    }
+
+    auto SplitAnyView::iterator::operator++(int) -> iterator
+    {
+        auto copy = *this;
+        Advance();
+        return copy;
+    }
+
+    bool SplitAnyView::iterator::operator==(const iterator& arg) const
+    {
+        return owner == arg.owner && (!owner || token.data() == arg.token.data());
+    }
+
+    bool SplitAnyView::iterator::operator!=(const iterator& arg) const
+    {
+        return !(*this == arg);
+    }
+
+    SplitAnyView::iterator::iterator(const SplitAnyView& owner) :
+        owner(&owner), position(owner.string.empty() ? std::string_view::npos : 0)
+    {
+        Advance();
+    }
+
+    void SplitAnyView::iterator::Advance()
+    {
+        const auto string = owner->string;
+        while (position != std::string_view::npos)
+        {
+            const auto tokenStart = position;
+            const auto tokenEnd = owner->TokenEnd(tokenStart);
+            position = tokenEnd == string.size() ? std::string_view::npos : tokenEnd + 1;
+
+            if (tokenEnd != tokenStart || owner->options.emptyTokens == EmptyTokens::Keep)
+            {
+                token = string.substr(tokenStart, tokenEnd - tokenStart);
+                return;
+            }
+        }
+
+        owner = nullptr;
+        token = {};
+    }
+
+    SplitAnyView::SplitAnyView(std::string_view string, const CharacterSet& delimiters, SplitAnyOptions options) :
+        string(string), options(options), stops(delimiters)
+    {
+        if (options.quote != '\0')
+            stops.Add(options.quote);
+    }
+
+    auto SplitAnyView::begin() const -> iterator
+    {
+        return iterator(*this);
+    }
+
+    auto SplitAnyView::end() const -> iterator
+    {
+        return iterator();
+    }
+
+    size_t SplitAnyView::TokenEnd(size_t from) const
+    {
+        auto position = from;
+        while (true)
+        {
+            position = stops.FindFirstIn(string, position);
+            if (position == std::string_view::npos)
+                return string.size();
+            if (options.quote == '\0' || string[position] != options.quote)
+                return position;
+
+            // An unclosed quote runs to the end
+            const auto close = string.find(options.quote, position + 1);
+            if (close == std::string_view::npos)
+                return string.size();
+            position = close + 1;
+        }
+    }
+
+    auto StreamSplitView::iterator::operator*() const -> reference
+    {
+        return owner->token;
+    }
+
+    auto StreamSplitView::iterator::operator->() const -> pointer
+    {
+        return &owner->token;
+    }
+
+    auto StreamSplitView::iterator::operator++() -> iterator&
+    {
+        if (!owner->Next())
+            owner = nullptr;
+        return *this;
+    }
+
+    void StreamSplitView::iterator::operator++(int)
+    {
+        ++*this;
+    }
+
+    bool StreamSplitView::iterator::operator==(const iterator& arg) const
+    {
+        return owner == arg.owner;
+    }
+
+    bool StreamSplitView::iterator::operator!=(const iterator& arg) const
+    {
+        return !(*this == arg);
+    }
+
+    StreamSplitView::iterator::iterator(StreamSplitView& owner) : owner(&owner)
+    {
+        if (!owner.Next())
+            this->owner = nullptr;
+    }
+
+    StreamSplitView::StreamSplitView(std::istream& stream, std::string_view splitter, size_t chunkSize) :
+        stream(&stream), splitter(splitter), chunkSize(std::max(chunkSize, size_t(1)))
+    {}
+
+    auto StreamSplitView::begin() -> iterator
+    {
+        return iterator(*this);
+    }
+
+    auto StreamSplitView::end() -> iterator
+    {
+        return iterator();
+    }
+
+    bool StreamSplitView::Next()
+    {
+        // Where the splitter could first start in the pending bytes, so bytes already scanned aren't scanned again
+        size_t searchFrom = 0;
+        while (true)
+        {
+            const std::string_view pending(buffer.data() + consumed, filled - consumed);
+            const auto found = splitter.empty()
+                ? std::string_view::npos
+                : FindInstance(pending, splitter, searchFrom);
+            if (found != std::string_view::npos)
+            {
+                token = pending.substr(0, found);
+                consumed += found + splitter.size();
+                searchFrom = 0;
+                if (!token.empty())
+                    return true;
+                continue;
+            }
+
+            if (exhausted)
+            {
+                token = pending;
+                consumed = filled;
+                return !token.empty();
+            }
+
+            searchFrom = pending.size() >= splitter.size() ? pending.size() - splitter.size() + 1 : 0;
+            Fill();
+        }
+    }
+
+    void StreamSplitView::Fill()
+    {
+        // Only the partial token is moved, and only once; tokens longer than the buffer grow it in place
+        if (consumed > 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+            filled -= consumed;
+            consumed = 0;
+        }
+
+        if (buffer.size() - filled < chunkSize)
+            buffer.resize(std::max(buffer.size() * 2, filled + chunkSize));
+
+        stream->read(buffer.data() + filled, static_cast<std::streamsize>(buffer.size() - filled));
+        const auto read = static_cast<size_t>(stream->gcount());
+        filled += read;
+        if (read == 0)
+            exhausted = true;
+    }
+}
\ No newline at end of file
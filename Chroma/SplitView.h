@@ -0,0 +1,185 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <istream>
+#include <iterator>
+
+#include "CharacterSet.h"
+
+namespace Chroma
+{
+    // Lazily yields the same tokens as Split, as views into string
+    class SplitView
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+        public:
+            iterator() = default;
+
+            reference operator*() const;
+            pointer operator->() const;
+
+            iterator& operator++();
+            iterator operator++(int);
+
+            bool operator==(const iterator& arg) const;
+            bool operator!=(const iterator& arg) const;
+        private:
+            // Null when past the end
+            const SplitView* owner = nullptr;
+            std::string_view token;
+            // Where the search for the next token starts
+            size_t position = 0;
+
+            explicit iterator(const SplitView& owner);
+
+            void Advance();
+        private:
+            friend SplitView;
+        };
+    public:
+        SplitView(std::string_view string, std::string_view splitter);
+
+        [[nodiscard]] iterator begin() const;
+        [[nodiscard]] iterator end() const;
+    private:
+        std::string_view string;
+        std::string_view splitter;
+    };
+
+    enum class EmptyTokens
+    {
+        // Runs of delimiters count as one, and delimiters at the ends yield nothing
+        Skip,
+        // Every delimiter ends a token, so n delimiters always give n + 1 tokens
+        Keep
+    };
+
+    struct SplitAnyOptions
+    {
+        EmptyTokens emptyTokens = EmptyTokens::Skip;
+        // Delimiters between a pair of these don't split, and the quotes stay in the token; '\0' turns quoting off
+        // A doubled quote inside quotes closes and reopens them, so it needs no special handling
+        char quote = '\0';
+    };
+
+    // Lazily splits string on any character in delimiters, in one pass, as views into string
+    // Empty strings have no tokens, even when keeping empty tokens
+    class SplitAnyView
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+        public:
+            iterator() = default;
+
+            reference operator*() const;
+            pointer operator->() const;
+
+            iterator& operator++();
+            iterator operator++(int);
+
+            bool operator==(const iterator& arg) const;
+            bool operator!=(const iterator& arg) const;
+        private:
+            // Null when past the end
+            const SplitAnyView* owner = nullptr;
+            std::string_view token;
+            // Where the next token starts, or npos after the last one
+            size_t position = 0;
+
+            explicit iterator(const SplitAnyView& owner);
+
+            void Advance();
+        private:
+            friend SplitAnyView;
+        };
+    public:
+        SplitAnyView(std::string_view string, const CharacterSet& delimiters, SplitAnyOptions options = {});
+
+        [[nodiscard]] iterator begin() const;
+        [[nodiscard]] iterator end() const;
+    private:
+        std::string_view string;
+        SplitAnyOptions options;
+        // The delimiters plus the quote, which are all a token can end or change state at
+        CharacterSet stops;
+
+        [[nodiscard]] size_t TokenEnd(size_t from) const;
+    };
+
+    // Yields the same tokens as Split over everything left in stream, reading it chunkSize bytes at a time
+    // Tokens that straddle chunks are stitched in the internal buffer
+    // Each yielded view is only valid until the iterator is incremented
+    class StreamSplitView
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+        public:
+            iterator() = default;
+
+            reference operator*() const;
+            pointer operator->() const;
+
+            iterator& operator++();
+            // Returns nothing since a copy would share the stream and see the next token anyway
+            void operator++(int);
+
+            bool operator==(const iterator& arg) const;
+            bool operator!=(const iterator& arg) const;
+        private:
+            // Null when past the end
+            StreamSplitView* owner = nullptr;
+
+            explicit iterator(StreamSplitView& owner);
+        private:
+            friend StreamSplitView;
+        };
+    public:
+        StreamSplitView(std::istream& stream, std::string_view splitter, size_t chunkSize = 64 * 1024);
+        StreamSplitView(const StreamSplitView& arg) = delete;
+        StreamSplitView& operator=(const StreamSplitView& arg) = delete;
+
+        // Single pass; begin can only be called once meaningfully
+        [[nodiscard]] iterator begin();
+        [[nodiscard]] iterator end();
+    private:
+        std::istream* stream;
+        std::string splitter;
+        size_t chunkSize;
+
+        std::vector<char> buffer;
+        // Start of the bytes not yet handed out
+        size_t consumed = 0;
+        // End of the bytes read from the stream
+        size_t filled = 0;
+        bool exhausted = false;
+
+        std::string_view token;
+
+        bool Next();
+        void Fill();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "Strand.h"
+
+namespace Chroma
+{
+    namespace
+    {
+        // The drain running on this thread, so a strand destroyed by its own task can tell it to stop touching the strand
+        struct Draining
+        {
+            const Strand* strand;
+            bool destroyed = false;
+            Strand::ErrorHandler onError;
+        };
+
+        thread_local Draining* currentDrain = nullptr;
+
+        void Report(const Strand::ErrorHandler& onError, std::exception_ptr error) noexcept
+        {
+            if (!onError)
+                std::terminate();
+
+            onError(error);
+        }
+    }
+
+    Strand::Strand(WorkerPool& pool, ErrorHandler onError) : pool(&pool), onError(std::move(onError))
+    {}
+
+    Strand::~Strand()
+    {
+        std::unique_lock lock(mutex);
+        if (currentDrain && currentDrain->strand == this)
+        {
+            // Waiting here would wait on the task doing the destroying
+            tasks.clear();
+            currentDrain->onError = std::move(onError);
+            currentDrain->destroyed = true;
+            return;
+        }
+
+        idle.wait(lock, [this]() { return !running; });
+    }
+
+    void Strand::Post(Task task)
+    {
+        {
+            std::lock_guard lock(mutex);
+            tasks.push_back(std::move(task));
+            if (running)
+                return;
+
+            running = true;
+        }
+
+        pool->Post([this]() { Drain(); });
+    }
+
+    void Strand::Drain()
+    {
+        std::deque<Task> batch;
+
+        {
+            std::lock_guard lock(mutex);
+            batch.swap(tasks);
+        }
+
+        Draining draining{ this };
+        const auto previousDrain = currentDrain;
+        currentDrain = &draining;
+
+        for (auto& task : batch)
+        {
+            // Letting an exception out would kill the worker and leave the strand marked running forever
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                Report(draining.destroyed ? draining.onError : onError, std::current_exception());
+            }
+
+            if (draining.destroyed)
+            {
+                currentDrain = previousDrain;
+                return;
+            }
+        }
+
+        currentDrain = previousDrain;
+
+        {
+            std::lock_guard lock(mutex);
+            if (!tasks.empty())
+            {
+                // Requeue instead of looping so a busy strand can't monopolize a worker
+                pool->Post([this]() { Drain(); });
+                return;
+            }
+
+            running = false;
+            // Notified under the lock since the destructor may be waiting to tear this down
+            idle.notify_all();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+#include "WorkerPool.h"
+
+namespace Chroma
+{
+    // Serial queue on top of a WorkerPool
+    // Tasks posted to the same strand run one at a time in posting order, on whichever worker picks them up
+    // A task that throws has its exception passed to the error handler on the worker, then the strand moves on to the next task
+    // Without a handler the exception calls std::terminate, so a failure is never lost; a handler that throws also terminates
+    // The pool must outlive the strand: the pool runs every queued task before it's destroyed, and those tasks use the strand
+    class Strand
+    {
+    public:
+        using Task = WorkerPool::Task;
+        using ErrorHandler = std::function<void(std::exception_ptr)>;
+    public:
+        explicit Strand(WorkerPool& pool, ErrorHandler onError = {});
+        Strand(const Strand& arg) = delete;
+        Strand(Strand&& arg) = delete;
+        // Blocks until every posted task has run
+        // Destroying the strand from one of its own tasks drops the tasks after it instead of waiting on itself
+        // Destroying it from any other task of the same pool can deadlock if no other worker is free to drain it
+        ~Strand();
+        Strand& operator=(const Strand& arg) = delete;
+        Strand& operator=(Strand&& arg) = delete;
+
+        // Never waits on other strands or on running tasks
+        void Post(Task task);
+    private:
+        WorkerPool* pool;
+        ErrorHandler onError;
+
+        std::deque<Task> tasks;
+        std::mutex mutex;
+        std::condition_variable idle;
+        // Set while a drain is queued on or running in the pool
+        bool running = false;
+
+        void Drain();
+    };
+}
\ No newline at end of file
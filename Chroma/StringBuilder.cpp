@@ -0,0 +1,60 @@
+#include "StringBuilder.h"
+
+namespace Chroma
+{
+    StringBuilder::StringBuilder(size_t reserve)
+    {
+        buffer.reserve(reserve);
+    }
+
+    StringBuilder& StringBuilder::Append(std::string_view string)
+    {
+        buffer.append(string);
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::Append(char character)
+    {
+        buffer.push_back(character);
+        return *this;
+    }
+
+    void StringBuilder::Reserve(size_t size)
+    {
+        buffer.reserve(size);
+    }
+
+    size_t StringBuilder::Size() const
+    {
+        return buffer.size();
+    }
+
+    std::string_view StringBuilder::View() const
+    {
+        return buffer;
+    }
+
+    std::string StringBuilder::Release()
+    {
+        auto released = std::move(buffer);
+        buffer.clear();
+        return released;
+    }
+
+    StringMeasure& StringMeasure::Append(std::string_view string)
+    {
+        size += string.size();
+        return *this;
+    }
+
+    StringMeasure& StringMeasure::Append(char)
+    {
+        ++size;
+        return *this;
+    }
+
+    size_t StringMeasure::Size() const
+    {
+        return size;
+    }
+}
\ No newline at end of file
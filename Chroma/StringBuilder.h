@@ -0,0 +1,113 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <iterator>
+
+#include "CharConv.h"
+#include "IntegerUtility.h"
+
+namespace Chroma
+{
+    // Accumulates a string; reserve up front, or use BuildString to size it exactly
+    class StringBuilder
+    {
+    public:
+        StringBuilder() = default;
+        explicit StringBuilder(size_t reserve);
+
+        StringBuilder& Append(std::string_view string);
+        StringBuilder& Append(char character);
+        template<class T, typename std::enable_if<detail::IsCharConvertible<T>, int>::type = 0>
+        StringBuilder& Append(T number);
+        template<class Iterator>
+        StringBuilder& AppendJoined(std::string_view joiner, Iterator begin, Iterator end);
+
+        void Reserve(size_t size);
+        [[nodiscard]] size_t Size() const;
+        [[nodiscard]] std::string_view View() const;
+        // Moves the built string out, leaving the builder empty
+        [[nodiscard]] std::string Release();
+    private:
+        std::string buffer;
+    };
+
+    // Same interface as StringBuilder, but only adds up the size that would be written
+    class StringMeasure
+    {
+    public:
+        StringMeasure& Append(std::string_view string);
+        StringMeasure& Append(char character);
+        template<class T, typename std::enable_if<detail::IsCharConvertible<T>, int>::type = 0>
+        StringMeasure& Append(T number);
+        template<class Iterator>
+        StringMeasure& AppendJoined(std::string_view joiner, Iterator begin, Iterator end);
+
+        [[nodiscard]] size_t Size() const;
+    private:
+        size_t size = 0;
+    };
+
+    // Calls build with a StringMeasure and then with a StringBuilder reserved to the measured size,
+    // so the result is allocated exactly once
+    // build must append the same things both times
+    template<class Build>
+    [[nodiscard]] std::string BuildString(Build build)
+    {
+        StringMeasure measure;
+        build(measure);
+
+        StringBuilder builder(measure.Size());
+        build(builder);
+        return builder.Release();
+    }
+
+    namespace detail
+    {
+        template<class Builder, class Iterator>
+        void AppendJoined(Builder& builder, std::string_view joiner, Iterator begin, Iterator end)
+        {
+            for (auto current = begin; current != end; ++current)
+            {
+                if (current != begin)
+                    builder.Append(joiner);
+                builder.Append(*current);
+            }
+        }
+    }
+
+    template<class T, typename std::enable_if<detail::IsCharConvertible<T>, int>::type>
+    StringBuilder& StringBuilder::Append(T number)
+    {
+        char digits[MaxChars<T>];
+        buffer.append(digits, detail::NumberToChars(digits, number));
+        return *this;
+    }
+
+    template<class Iterator>
+    StringBuilder& StringBuilder::AppendJoined(std::string_view joiner, Iterator begin, Iterator end)
+    {
+        detail::AppendJoined(*this, joiner, begin, end);
+        return *this;
+    }
+
+    template<class T, typename std::enable_if<detail::IsCharConvertible<T>, int>::type>
+    StringMeasure& StringMeasure::Append(T number)
+    {
+        if constexpr (std::is_integral_v<T>)
+            size += static_cast<size_t>(Digits(number)) + (number < 0);
+        else
+        {
+            char buffer[MaxChars<T>];
+            size += detail::NumberToChars(buffer, number) - buffer;
+        }
+        return *this;
+    }
+
+    template<class Iterator>
+    StringMeasure& StringMeasure::AppendJoined(std::string_view joiner, Iterator begin, Iterator end)
+    {
+        detail::AppendJoined(*this, joiner, begin, end);
+        return *this;
+    }
+}
\ No newline at end of file
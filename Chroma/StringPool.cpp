@@ -0,0 +1,132 @@
+#include "StringPool.h"
+
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace Chroma
+{
+    std::string_view InternedString::View() const
+    {
+        return entry ? entry->text : std::string_view();
+    }
+
+    std::string InternedString::String() const
+    {
+        return std::string(View());
+    }
+
+    size_t InternedString::Size() const
+    {
+        return View().size();
+    }
+
+    bool InternedString::Empty() const
+    {
+        return entry == nullptr;
+    }
+
+    size_t InternedString::Hash() const
+    {
+        return entry ? entry->hash : 0;
+    }
+
+    InternedString::operator std::string_view() const
+    {
+        return View();
+    }
+
+    bool InternedString::operator==(const InternedString& arg) const
+    {
+        return entry == arg.entry;
+    }
+
+    bool InternedString::operator!=(const InternedString& arg) const
+    {
+        return !(*this == arg);
+    }
+
+    InternedString::InternedString(const detail::InternedEntry* entry) : entry(entry)
+    {}
+
+    InternedString StringPool::Intern(std::string_view string)
+    {
+        if (string.empty())
+            return {};
+
+        const auto hash = std::hash<std::string_view>{}(string);
+        auto& shard = shards[hash % shardCount];
+
+        {
+            std::shared_lock lock(shard.mutex);
+            if (const auto found = shard.Find(string))
+                return InternedString(found);
+        }
+
+        std::unique_lock lock(shard.mutex);
+        // Another thread may have inserted it between the two locks
+        if (const auto found = shard.Find(string))
+            return InternedString(found);
+
+        const auto characters = shard.Allocate(string.size(), 1);
+        std::memcpy(characters, string.data(), string.size());
+        const auto entry = new (shard.Allocate(sizeof(detail::InternedEntry), alignof(detail::InternedEntry)))
+            detail::InternedEntry{ std::string_view(characters, string.size()), hash };
+        shard.entries.emplace(entry->text, entry);
+        return InternedString(entry);
+    }
+
+    InternedString StringPool::Find(std::string_view string) const
+    {
+        if (string.empty())
+            return {};
+
+        const auto& shard = shards[std::hash<std::string_view>{}(string) % shardCount];
+        std::shared_lock lock(shard.mutex);
+        return InternedString(shard.Find(string));
+    }
+
+    size_t StringPool::Size() const
+    {
+        size_t size = 0;
+        for (auto& shard : shards)
+        {
+            std::shared_lock lock(shard.mutex);
+            size += shard.entries.size();
+        }
+
+        return size;
+    }
+
+    auto StringPool::Shard::Find(std::string_view string) const -> const detail::InternedEntry*
+    {
+        const auto found = entries.find(string);
+        return found != entries.end() ? found->second : nullptr;
+    }
+
+    char* StringPool::Shard::Allocate(size_t size, size_t alignment)
+    {
+        // Strings too long for a chunk get one to themselves, kept out of the way of the current chunk
+        if (size > chunkSize)
+        {
+            chunks.insert(chunks.begin(), std::unique_ptr<char[]>(new char[size]));
+            return chunks.front().get();
+        }
+
+        auto offset = (chunkUsed + alignment - 1) / alignment * alignment;
+        if (chunks.empty() || offset + size > chunkSize)
+        {
+            chunks.push_back(std::unique_ptr<char[]>(new char[chunkSize]));
+            offset = 0;
+        }
+
+        chunkUsed = offset + size;
+        return chunks.back().get() + offset;
+    }
+
+    InternedString Intern(std::string_view string)
+    {
+        static StringPool pool;
+        return pool.Intern(string);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <shared_mutex>
+
+namespace Chroma
+{
+    namespace detail
+    {
+        struct InternedEntry
+        {
+            std::string_view text;
+            size_t hash;
+        };
+    }
+
+    // Handle to a string held by a StringPool
+    // Equality and hashing are O(1); handles from different pools never compare equal, except empty ones, which are the same everywhere
+    class InternedString
+    {
+    public:
+        // The empty string
+        InternedString() = default;
+
+        [[nodiscard]] std::string_view View() const;
+        [[nodiscard]] std::string String() const;
+        [[nodiscard]] size_t Size() const;
+        [[nodiscard]] bool Empty() const;
+        [[nodiscard]] size_t Hash() const;
+
+        operator std::string_view() const;
+
+        bool operator==(const InternedString& arg) const;
+        bool operator!=(const InternedString& arg) const;
+    private:
+        const detail::InternedEntry* entry = nullptr;
+
+        explicit InternedString(const detail::InternedEntry* entry);
+        friend class StringPool;
+    };
+
+    // Stores each distinct string once; handles stay valid for the pool's lifetime
+    // Safe to intern into from several threads at once
+    class StringPool
+    {
+    public:
+        StringPool() = default;
+        StringPool(const StringPool& arg) = delete;
+        StringPool(StringPool&& arg) = delete;
+        StringPool& operator=(const StringPool& arg) = delete;
+        StringPool& operator=(StringPool&& arg) = delete;
+
+        InternedString Intern(std::string_view string);
+        // Returns the empty handle if the string has not been interned
+        [[nodiscard]] InternedString Find(std::string_view string) const;
+
+        [[nodiscard]] size_t Size() const;
+    private:
+        static constexpr size_t shardCount = 16;
+        static constexpr size_t chunkSize = 64 * 1024;
+
+        // Each shard owns the chunks its entries and characters live in, so it only needs its own lock
+        struct Shard
+        {
+            std::unordered_map<std::string_view, const detail::InternedEntry*> entries;
+            std::vector<std::unique_ptr<char[]>> chunks;
+            size_t chunkUsed = chunkSize;
+            mutable std::shared_mutex mutex;
+
+            [[nodiscard]] const detail::InternedEntry* Find(std::string_view string) const;
+            char* Allocate(size_t size, size_t alignment);
+        };
+
+        std::array<Shard, shardCount> shards;
+    };
+
+    // Interns into a pool shared by the whole process
+    InternedString Intern(std::string_view string);
+}
+
+namespace std
+{
+    template<>
+    struct hash<Chroma::InternedString>
+    {
+        size_t operator()(const Chroma::InternedString& arg) const noexcept
+        {
+            return arg.Hash();
+        }
+    };
+}
\ No newline at end of file
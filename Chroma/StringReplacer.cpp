@@ -0,0 +1,184 @@
+#include "StringReplacer.h"
+
+#include <deque>
+
+namespace Chroma
+{
+    std::string StringReplacer::Replace(std::string_view input) const
+    {
+        std::string output;
+        Replace(input, output);
+        return output;
+    }
+
+    void StringReplacer::Replace(std::string_view input, std::string& output) const
+    {
+        output.reserve(output.size() + ReplacedSize(input));
+
+        size_t copyFrom = 0;
+        Scan(input, [&](size_t start, size_t length, std::uint32_t pattern)
+        {
+            output.append(input.substr(copyFrom, start - copyFrom));
+            output.append(replacements[pattern]);
+            copyFrom = start + length;
+        });
+
+        output.append(input.substr(copyFrom));
+    }
+
+    size_t StringReplacer::ReplacedSize(std::string_view input) const
+    {
+        auto size = input.size();
+        Scan(input, [&](size_t, size_t length, std::uint32_t pattern)
+        {
+            size = size - length + replacements[pattern].size();
+        });
+
+        return size;
+    }
+
+    void StringReplacer::Add(std::string_view pattern, std::string_view replacement)
+    {
+        if (pattern.empty())
+            return;
+
+        for (auto& existing : patterns)
+            if (existing == pattern)
+                return;
+
+        patterns.emplace_back(pattern);
+        replacements.emplace_back(replacement);
+    }
+
+    void StringReplacer::Compile()
+    {
+        byteClasses = {};
+        classCount = 1;
+        for (auto& pattern : patterns)
+        {
+            for (auto character : pattern)
+            {
+                auto& byteClass = byteClasses[static_cast<std::uint8_t>(character)];
+                if (byteClass == 0)
+                    byteClass = static_cast<std::uint16_t>(classCount++);
+            }
+        }
+
+        constexpr auto missing = UINT32_MAX;
+        transitions.assign(classCount, missing);
+        depths.assign(1, 0);
+        outputs.assign(1, noPattern);
+
+        for (std::uint32_t patternIndex = 0; patternIndex < patterns.size(); ++patternIndex)
+        {
+            State state = root;
+            for (auto character : patterns[patternIndex])
+            {
+                auto& transition = transitions[state * classCount + byteClasses[static_cast<std::uint8_t>(character)]];
+                if (transition == missing)
+                {
+                    transition = static_cast<State>(depths.size());
+                    depths.push_back(depths[state] + 1);
+                    outputs.push_back(noPattern);
+                    transitions.resize(transitions.size() + classCount, missing);
+                }
+
+                // The resize may have moved the table, so don't reuse the reference
+                state = transitions[state * classCount + byteClasses[static_cast<std::uint8_t>(character)]];
+            }
+
+            outputs[state] = patternIndex;
+        }
+
+        // Breadth first, turning the trie into a full automaton by folding failure links into the transitions
+        std::vector<State> failures(depths.size(), root);
+        std::deque<State> queue;
+        for (size_t byteClass = 0; byteClass < classCount; ++byteClass)
+        {
+            auto& transition = transitions[byteClass];
+            if (transition == missing)
+                transition = root;
+            else
+                queue.push_back(transition);
+        }
+
+        while (!queue.empty())
+        {
+            const auto state = queue.front();
+            queue.pop_front();
+
+            const auto failure = failures[state];
+            if (outputs[state] == noPattern)
+                outputs[state] = outputs[failure];
+
+            for (size_t byteClass = 0; byteClass < classCount; ++byteClass)
+            {
+                auto& transition = transitions[state * classCount + byteClass];
+                const auto failureTransition = transitions[failure * classCount + byteClass];
+                if (transition == missing)
+                    transition = failureTransition;
+                else
+                {
+                    failures[transition] = failureTransition;
+                    queue.push_back(transition);
+                }
+            }
+        }
+    }
+
+    template<class OnMatch>
+    void StringReplacer::Scan(std::string_view input, OnMatch onMatch) const
+    {
+        if (patterns.empty())
+            return;
+
+        bool hasMatch = false;
+        size_t matchStart = 0;
+        size_t matchLength = 0;
+        std::uint32_t matchPattern = noPattern;
+
+        State state = root;
+        size_t position = 0;
+        while (true)
+        {
+            if (position == input.size())
+            {
+                if (!hasMatch)
+                    break;
+
+                // Anything past the pending match was only scanned in its shadow, so go back for it
+                onMatch(matchStart, matchLength, matchPattern);
+                hasMatch = false;
+                position = matchStart + matchLength;
+                state = root;
+                continue;
+            }
+
+            state = transitions[state * classCount + byteClasses[static_cast<std::uint8_t>(input[position])]];
+            ++position;
+
+            const auto output = outputs[state];
+            if (output != noPattern)
+            {
+                const auto length = patterns[output].size();
+                const auto start = position - length;
+                if (!hasMatch || start < matchStart || (start == matchStart && length > matchLength))
+                {
+                    hasMatch = true;
+                    matchStart = start;
+                    matchLength = length;
+                    matchPattern = output;
+                }
+            }
+
+            // Once no partial match could start at or before the pending one, it can't be beaten
+            if (hasMatch && matchStart < position - depths[state])
+            {
+                onMatch(matchStart, matchLength, matchPattern);
+                hasMatch = false;
+                position = matchStart + matchLength;
+                state = root;
+            }
+        }
+    }
+}
\ No newline at end of file
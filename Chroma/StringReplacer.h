@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <cstdint>
+
+namespace Chroma
+{
+    // Replaces any number of patterns in a single pass over the input
+    // The patterns are compiled once into an Aho-Corasick automaton, so a replacer should be kept around and reused
+    // Where matches overlap, the leftmost wins, then the longest; empty patterns are ignored
+    class StringReplacer
+    {
+    public:
+        StringReplacer() = default;
+        // Map is any range of pattern/replacement pairs
+        template<class Map>
+        explicit StringReplacer(const Map& replacements);
+
+        [[nodiscard]] std::string Replace(std::string_view input) const;
+        // Appends the replaced input to output
+        void Replace(std::string_view input, std::string& output) const;
+        // Size of the string Replace would produce
+        [[nodiscard]] size_t ReplacedSize(std::string_view input) const;
+    private:
+        using State = std::uint32_t;
+        static constexpr State root = 0;
+        static constexpr std::uint32_t noPattern = UINT32_MAX;
+
+        std::vector<std::string> patterns;
+        std::vector<std::string> replacements;
+
+        // Bytes that appear in no pattern share class 0, which keeps the transition table narrow
+        // Patterns can use all 256 bytes, which with class 0 needs more than 8 bits
+        std::array<std::uint16_t, 256> byteClasses = {};
+        size_t classCount = 1;
+        // Indexed by state * classCount + class
+        std::vector<State> transitions;
+        std::vector<std::uint32_t> depths;
+        // Longest pattern that ends at each state
+        std::vector<std::uint32_t> outputs;
+
+        void Add(std::string_view pattern, std::string_view replacement);
+        void Compile();
+
+        template<class OnMatch>
+        void Scan(std::string_view input, OnMatch onMatch) const;
+    };
+
+    template<class Map>
+    StringReplacer::StringReplacer(const Map& replacements)
+    {
+        for (auto& [pattern, replacement] : replacements)
+            Add(pattern, replacement);
+
+        Compile();
+    }
+
+    // Compiles a throwaway StringReplacer; prefer keeping a StringReplacer for repeated use
+    template<class Map>
+    [[nodiscard]] std::string ReplaceAll(std::string_view input, const Map& replacements)
+    {
+        return StringReplacer(replacements).Replace(input);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "StringSearch.h"
+
+#include <cstring>
+#include <bit>
+
+#if defined(__AVX2__)
+#define CHROMA_SEARCH_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CHROMA_SEARCH_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Chroma
+{
+    namespace
+    {
+        // Checks the bytes between the first and last, which the candidate filter has already matched
+        bool MiddleMatches(const char* candidate, const char* of, size_t ofSize)
+        {
+            return ofSize <= 2 || std::memcmp(candidate + 1, of + 1, ofSize - 2) == 0;
+        }
+
+        size_t FindScalar(const char* input, size_t begin, size_t end, const char* of, size_t ofSize)
+        {
+            const auto last = of[ofSize - 1];
+            // end is one past the last position a match can start at
+            auto position = begin;
+            while (position < end)
+            {
+                const auto found = static_cast<const char*>(std::memchr(input + position, of[0], end - position));
+                if (!found)
+                    return std::string_view::npos;
+
+                position = found - input;
+                if (input[position + ofSize - 1] == last && MiddleMatches(found, of, ofSize))
+                    return position;
+                ++position;
+            }
+
+            return std::string_view::npos;
+        }
+
+#if defined(CHROMA_SEARCH_AVX2)
+        size_t FindVector(const char* input, size_t& position, size_t end, const char* of, size_t ofSize)
+        {
+            constexpr size_t width = 32;
+            const auto first = _mm256_set1_epi8(of[0]);
+            const auto last = _mm256_set1_epi8(of[ofSize - 1]);
+            for (; position + width <= end; position += width)
+            {
+                const auto blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + position));
+                const auto blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + position + ofSize - 1));
+                auto mask = static_cast<unsigned int>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast))));
+                while (mask != 0)
+                {
+                    const auto candidate = position + std::countr_zero(mask);
+                    if (MiddleMatches(input + candidate, of, ofSize))
+                        return candidate;
+                    mask &= mask - 1;
+                }
+            }
+
+            return std::string_view::npos;
+        }
+#elif defined(CHROMA_SEARCH_SSE2)
+        size_t FindVector(const char* input, size_t& position, size_t end, const char* of, size_t ofSize)
+        {
+            constexpr size_t width = 16;
+            const auto first = _mm_set1_epi8(of[0]);
+            const auto last = _mm_set1_epi8(of[ofSize - 1]);
+            for (; position + width <= end; position += width)
+            {
+                const auto blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + position));
+                const auto blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + position + ofSize - 1));
+                auto mask = static_cast<unsigned int>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast))));
+                while (mask != 0)
+                {
+                    const auto candidate = position + std::countr_zero(mask);
+                    if (MiddleMatches(input + candidate, of, ofSize))
+                        return candidate;
+                    mask &= mask - 1;
+                }
+            }
+
+            return std::string_view::npos;
+        }
+#endif
+    }
+
+    size_t FindInstance(std::string_view input, std::string_view of, size_t from)
+    {
+        if (from > input.size() || of.size() > input.size() - from)
+            return std::string_view::npos;
+
+        if (of.empty())
+            return from;
+
+        if (of.size() == 1)
+        {
+            const auto found = static_cast<const char*>(std::memchr(input.data() + from, of[0], input.size() - from));
+            return found ? static_cast<size_t>(found - input.data()) : std::string_view::npos;
+        }
+
+        // One past the last position a match can start at
+        const auto end = input.size() - of.size() + 1;
+        auto position = from;
+#if defined(CHROMA_SEARCH_AVX2) || defined(CHROMA_SEARCH_SSE2)
+        const auto found = FindVector(input.data(), position, end, of.data(), of.size());
+        if (found != std::string_view::npos)
+            return found;
+#endif
+        return FindScalar(input.data(), position, end, of.data(), of.size());
+    }
+
+    StringSearcher::StringSearcher(std::string_view pattern) : pattern(pattern)
+    {
+        // Below this the vector filter is faster; skipping only pays for itself once it can move far
+        constexpr size_t horspoolLength = 64;
+        // The filter rarely rules out candidates on a small alphabet, but on a varied one it holds up until patterns get longer
+        constexpr size_t variedAlphabet = 32;
+        constexpr size_t variedHorspoolLength = 128;
+        if (pattern.size() < horspoolLength)
+            return;
+
+        bool seen[256] = {};
+        size_t alphabet = 0;
+        for (auto character : pattern)
+        {
+            auto& entry = seen[static_cast<unsigned char>(character)];
+            alphabet += !entry;
+            entry = true;
+        }
+
+        if (alphabet > variedAlphabet && pattern.size() < variedHorspoolLength)
+            return;
+
+        const auto pair = [&](size_t at)
+        {
+            return static_cast<unsigned char>(pattern[at]) << 8 | static_cast<unsigned char>(pattern[at + 1]);
+        };
+        const auto cap = [](size_t skip)
+        {
+            return static_cast<std::uint8_t>(skip < 255 ? skip : 255);
+        };
+
+        // A pair that isn't in the pattern lets the window move past all but its last byte
+        skips.assign(65536, cap(pattern.size() - 1));
+        const auto lastPair = pattern.size() - 2;
+        for (size_t i = 0; i < lastPair; ++i)
+            skips[pair(i)] = cap(lastPair - i);
+        skipAfterMatch = skips[pair(lastPair)];
+        skips[pair(lastPair)] = 0;
+    }
+
+    size_t StringSearcher::Find(std::string_view input, size_t from) const
+    {
+        if (skips.empty())
+            return FindInstance(input, pattern, from);
+
+        if (from > input.size() || pattern.size() > input.size() - from)
+            return std::string_view::npos;
+
+        const auto size = pattern.size();
+        const auto end = input.size() - size;
+        for (auto position = from; position <= end;)
+        {
+            const auto window = input.data() + position + size - 2;
+            const auto skip = skips[static_cast<unsigned char>(window[0]) << 8 | static_cast<unsigned char>(window[1])];
+            if (skip != 0)
+            {
+                position += skip;
+                continue;
+            }
+
+            if (std::memcmp(input.data() + position, pattern.data(), size - 2) == 0)
+                return position;
+            position += skipAfterMatch;
+        }
+
+        return std::string_view::npos;
+    }
+
+    std::string_view StringSearcher::Pattern() const
+    {
+        return pattern;
+    }
+}
\ No newline at end of file
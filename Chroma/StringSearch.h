@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace Chroma
+{
+    // Position of the first instance of of in input at or after from, or npos if there is none
+    // An empty pattern is found at from
+    [[nodiscard]] size_t FindInstance(std::string_view input, std::string_view of, size_t from = 0);
+
+    // Pattern prepared once for searching many inputs
+    // Short patterns use the vector first/last byte filter
+    // Long patterns use Horspool keyed on the last two bytes of the window, which usually skips nearly a whole pattern length
+    class StringSearcher
+    {
+    public:
+        explicit StringSearcher(std::string_view pattern);
+
+        // Same contract as FindInstance
+        [[nodiscard]] size_t Find(std::string_view input, size_t from = 0) const;
+
+        [[nodiscard]] std::string_view Pattern() const;
+    private:
+        std::string pattern;
+        // Empty when the filter is used; otherwise how far the window can move for each byte pair, capped to fit a byte
+        std::vector<std::uint8_t> skips;
+        size_t skipAfterMatch = 0;
+    };
+}
\ No newline at end of file
@@ -1,113 +1,162 @@
 #include "StringUtility.h"
 
-#include <locale>
-#include <codecvt>
+#include "Unicode.h"
 
 namespace Chroma
 {
-    std::string ToUppercase(const std::string& string)
+    std::string ToUppercase(std::string_view string)
     {
-        std::string output;
-        for (auto character : string)
-            output += std::toupper(character);
+        std::string output(string.size(), '\0');
+        ToUppercase(string, output.data());
         return output;
     }
 
-    std::string ReplaceString(const std::string& string, const std::string& instance, const std::string& with)
+    std::string ToLowercase(std::string_view string)
     {
-        const auto instanceSize = instance.size();
-        auto output = string;
-        for(size_t i = 0; i < output.size();)
+        std::string output(string.size(), '\0');
+        ToLowercase(string, output.data());
+        return output;
+    }
+
+    std::string CaseFold(std::string_view string)
+    {
+        std::string output(string.size(), '\0');
+        CaseFold(string, output.data());
+        return output;
+    }
+
+    namespace
+    {
+        template<class Find>
+        std::string ReplaceFound(std::string_view string, size_t instanceSize, std::string_view with, Find find)
         {
-            const auto checkString = output.substr(i, instanceSize);
-            if (checkString != instance)
+            return BuildString([&](auto& builder)
             {
-                ++i;
-                continue;
-            }
-
-            output.replace(i, instanceSize, with);
-            i += with.size();
+                size_t copyFrom = 0;
+                for (auto position = find(0); position != std::string::npos; position = find(copyFrom))
+                {
+                    builder.Append(string.substr(copyFrom, position - copyFrom));
+                    builder.Append(with);
+                    copyFrom = position + instanceSize;
+                }
+
+                builder.Append(string.substr(copyFrom));
+            });
         }
+    }
 
-        return output;
+    std::string ReplaceString(std::string_view string, std::string_view instance, std::string_view with)
+    {
+        if (instance.empty())
+            return std::string(string);
+
+        return ReplaceFound(string, instance.size(), with, [&](size_t from) { return FindInstance(string, instance, from); });
     }
 
-    bool Contains(const std::string& input, const std::string& of)
+    std::string ReplaceString(std::string_view string, const StringSearcher& instance, std::string_view with)
     {
-        return CountInstances(input, of) > 0;
+        if (instance.Pattern().empty())
+            return std::string(string);
+
+        return ReplaceFound(string, instance.Pattern().size(), with, [&](size_t from) { return instance.Find(string, from); });
     }
 
-    void SpliceString(std::string& in, const std::string& check, const std::string& replace)
+    size_t CountInstances(std::string_view input, const StringSearcher& of)
     {
-        auto pos = in.find(check);
+        if (of.Pattern().empty())
+            return input.size();
 
-        while (pos != std::string::npos)
-        {
-            in.erase(pos, check.size());
-            in.insert(pos, replace);
+        size_t instances = 0;
+        for (auto position = of.Find(input); position != std::string::npos; position = of.Find(input, position + 1))
+            ++instances;
+        return instances;
+    }
 
-            pos = in.find(check);
-        }
+    bool Contains(std::string_view input, std::string_view of)
+    {
+        // An empty pattern counts as an instance at every position
+        if (of.empty())
+            return !input.empty();
+
+        return FindInstance(input, of) != std::string::npos;
     }
 
-    void Trim(std::string& trim)
+    bool Contains(std::string_view input, const StringSearcher& of)
     {
-        while (trim[0] == ' ' || trim[0] == '\n')
-            trim.erase(0, 1);
+        if (of.Pattern().empty())
+            return !input.empty();
 
-        while (trim[trim.size() - 1] == ' ' || trim[trim.size() - 1] == '\n')
-            trim.erase(trim.size() - 1, 1);
+        return of.Find(input) != std::string::npos;
     }
 
-    std::string Trim(const std::string& trim)
+    void SpliceString(std::string& in, std::string_view check, std::string_view replace)
     {
-        if (trim.empty())
-            return trim;
+        if (check.empty() || FindInstance(in, check) == std::string::npos)
+            return;
 
-        std::string ret = trim;
+        in = ReplaceString(in, check, replace);
+    }
 
-        while (ret[ret.size() - 1] == ' ' || ret[ret.size() - 1] == '\n')
-        {
-            ret.erase(ret.size() - 1, 1);
+    void TrimInPlace(std::string& trim, const CharacterSet& characters)
+    {
+        // Erases once from each end rather than a character at a time
+        trim.erase(TrimRight(trim, characters).size());
+        trim.erase(0, trim.size() - TrimLeft(trim, characters).size());
+    }
 
-            if (ret.empty())
-                return ret;
-        }
+    std::string Trim(const std::string& trim, const CharacterSet& characters)
+    {
+        return std::string(Trim(std::string_view(trim), characters));
+    }
 
-        while (ret[0] == ' ' || ret[0] == '\n')
-            ret.erase(0, 1);
+    std::string Trim(const char* trim, const CharacterSet& characters)
+    {
+        return std::string(Trim(std::string_view(trim), characters));
+    }
 
-        return ret;
+    std::string_view Trim(std::string_view trim, const CharacterSet& characters)
+    {
+        return TrimRight(TrimLeft(trim, characters), characters);
     }
 
-    bool IsAllWhitespace(const std::string& check)
+    std::string_view TrimLeft(std::string_view trim, const CharacterSet& characters)
     {
-        if (check.empty())
-            return false;
+        const auto begin = characters.FindFirstNotIn(trim);
+        return begin == std::string_view::npos ? trim.substr(trim.size()) : trim.substr(begin);
+    }
 
-        for (auto &c : check)
-        {
-            if (c != ' ' && c != '\n')
-                return false;
-        }
+    std::string_view TrimRight(std::string_view trim, const CharacterSet& characters)
+    {
+        const auto last = characters.FindLastNotIn(trim);
+        return last == std::string_view::npos ? trim.substr(0, 0) : trim.substr(0, last + 1);
+    }
 
-        return true;
+    bool IsAllWhitespace(std::string_view check, const CharacterSet& characters)
+    {
+        return !check.empty() && characters.FindFirstNotIn(check) == std::string_view::npos;
     }
 
-    bool StartsWith(const std::string& check, const std::string& startsWith)
+    bool StartsWith(std::string_view check, std::string_view startsWith)
     {
-        const auto subString = check.substr(0, startsWith.size());
-        return subString == startsWith;
+        return check.starts_with(startsWith);
     }
 
-    bool EndsWith(const std::string& check, const std::string& endsWith)
+    bool EndsWith(std::string_view check, std::string_view endsWith)
     {
-        if (endsWith.size() > check.size())
-            return false;
+        return check.ends_with(endsWith);
+    }
 
-        const auto subString = check.substr(check.size() - endsWith.size(), endsWith.size());
-        return subString == endsWith;
+    std::vector<std::string_view> Split(std::string_view string, std::string_view splitter)
+    {
+        return Split<std::string_view>(string, splitter);
+    }
+
+    std::vector<std::string_view> SplitAny(std::string_view string, const CharacterSet& delimiters, SplitAnyOptions options)
+    {
+        std::vector<std::string_view> tokens;
+        for (auto token : SplitAnyView(string, delimiters, options))
+            tokens.push_back(token);
+        return tokens;
     }
 
     namespace detail
@@ -121,13 +170,7 @@ namespace Chroma
     template<class T>
     T FromStringCommon(const std::string& arg)
     {
-        long long returned = ::std::strtoll(arg.c_str(), nullptr, 10);
-        if (returned > ::std::numeric_limits<T>::max())
-            return ::std::numeric_limits<T>::max();
-        else if (returned < ::std::numeric_limits<T>::min())
-            return ::std::numeric_limits<T>::min();
-        else
-            return static_cast<T>(returned);
+        return detail::FromCharsSaturating<T>(arg, detail::NegativeUnsigned::Clamp);
     }
 
     template<> char FromString(const std::string& arg)
@@ -198,12 +241,12 @@ namespace Chroma
 
     std::string ToString(const std::wstring& arg)
     {
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-        return std::string(converter.to_bytes(arg));
+        return ToUtf8(std::wstring_view(arg));
     }
 
     std::string ToString(const std::filesystem::path& arg)
     {
-        return ToString(std::wstring(arg));
+        // The native form is narrow on POSIX and UTF-16 on Windows, so this picks the right overload
+        return ToString(arg.native());
     }
 }
\ No newline at end of file
@@ -1,58 +1,83 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 #include <filesystem>
 
 #include "TypeIdentity.h"
+#include "StringSearch.h"
+#include "CharConv.h"
+#include "StringBuilder.h"
+#include "CharacterSet.h"
+#include "CaseConversion.h"
+#include "SplitView.h"
+#include "EnumName.h"
 
 namespace Chroma
 {
-    std::string ToUppercase(const std::string& string);
+    std::string ToUppercase(std::string_view string);
+    std::string ToLowercase(std::string_view string);
+    std::string CaseFold(std::string_view string);
 
-    std::string ReplaceString(const std::string& string, const std::string& instance, const std::string& with);
+    std::string ReplaceString(std::string_view string, std::string_view instance, std::string_view with);
+    std::string ReplaceString(std::string_view string, const StringSearcher& instance, std::string_view with);
 
+    namespace detail
+    {
+        template<class String>
+        size_t FindInstance(const String& input, const String& of, size_t from)
+        {
+            if constexpr (std::is_same_v<typename String::value_type, char>)
+                return ::Chroma::FindInstance(input, of, from);
+            else
+                return input.find(of, from);
+        }
+    }
+
+    // Counts overlapping instances
     template<class String>
     [[nodiscard]] size_t CountInstances(const String& input, const String& of)
     {
+        if (of.empty())
+            return input.size();
+
         size_t instances = 0;
-        const auto instanceSize = of.size();
-        for (size_t i = 0; i < input.size(); ++i)
+        auto position = detail::FindInstance(input, of, 0);
+        while (position != String::npos)
         {
-            const auto substring = input.substr(i, instanceSize);
-            if (substring == of)
-                ++instances;
+            ++instances;
+            position = detail::FindInstance(input, of, position + 1);
         }
 
         return instances;
     }
 
-    [[nodiscard]] bool Contains(const std::string& input, const std::string& of);
-
-    void SpliceString(std::string& in, const std::string& check, const std::string& replace);
-
-    std::string Trim(const std::string& trim);
-    bool IsAllWhitespace(const std::string& check);
-    bool StartsWith(const std::string& check, const std::string& startsWith);
-    bool EndsWith(const std::string& check, const std::string& endsWith);
+    [[nodiscard]] size_t CountInstances(std::string_view input, const StringSearcher& of);
+
+    [[nodiscard]] bool Contains(std::string_view input, std::string_view of);
+    [[nodiscard]] bool Contains(std::string_view input, const StringSearcher& of);
+
+    void SpliceString(std::string& in, std::string_view check, std::string_view replace);
+
+    // Trimming removes characters in characters from the ends, which by default is all ASCII whitespace
+    std::string Trim(const std::string& trim, const CharacterSet& characters = whitespace);
+    std::string Trim(const char* trim, const CharacterSet& characters = whitespace);
+    // Not an overload of Trim, which would make Trim on a non-const string modify it instead of returning a copy
+    void TrimInPlace(std::string& trim, const CharacterSet& characters = whitespace);
+    // The view overloads return views into trim
+    [[nodiscard]] std::string_view Trim(std::string_view trim, const CharacterSet& characters = whitespace);
+    [[nodiscard]] std::string_view TrimLeft(std::string_view trim, const CharacterSet& characters = whitespace);
+    [[nodiscard]] std::string_view TrimRight(std::string_view trim, const CharacterSet& characters = whitespace);
+    // False for an empty string
+    bool IsAllWhitespace(std::string_view check, const CharacterSet& characters = whitespace);
+    bool StartsWith(std::string_view check, std::string_view startsWith);
+    bool EndsWith(std::string_view check, std::string_view endsWith);
     template<class T>
     std::string Join(std::string joiner, T begin, T end)
     {
-        if (begin == end)
-            return "";
-
-        std::string returnValue;
-        const auto prevEnd = std::prev(end);
-        auto current = begin;
-        while (current != end)
-        {
-            returnValue += *current;
-            if (current != prevEnd)
-                returnValue += joiner;
-            current = std::next(current);
-        }
-        return returnValue;
+        return BuildString([&](auto& builder) { builder.AppendJoined(joiner, begin, end); });
     }
     template<class T>
     std::string Join(T begin, T end)
@@ -66,60 +91,74 @@ namespace Chroma
         if (string.empty())
             return {};
 
-        auto manipulateString = string;
-        auto splitterPosition = manipulateString.find(splitter);
+        auto splitterPosition = splitter.empty() ? String::npos : detail::FindInstance(string, splitter, 0);
         if (splitterPosition == String::npos)
-            return { manipulateString };
+            return { string };
 
         std::vector<String> returnValue;
-        returnValue.reserve(CountInstances(string, splitter));
+        returnValue.reserve(CountInstances(string, splitter) + 1);
 
+        size_t tokenStart = 0;
         while (splitterPosition != String::npos)
         {
-            auto substr = manipulateString.substr(0, splitterPosition);
-            if (!substr.empty())
-                returnValue.push_back(substr);
-            manipulateString.erase(0, splitterPosition + splitter.size());
-            splitterPosition = manipulateString.find(splitter);
+            if (splitterPosition != tokenStart)
+                returnValue.push_back(string.substr(tokenStart, splitterPosition - tokenStart));
+            tokenStart = splitterPosition + splitter.size();
+            splitterPosition = detail::FindInstance(string, splitter, tokenStart);
         }
 
-        if (!manipulateString.empty())
-            returnValue.push_back(manipulateString);
+        if (tokenStart < string.size())
+            returnValue.push_back(string.substr(tokenStart));
 
         return returnValue;
     }
 
-    template<class T>
-    void SpliceString(std::string& in, const std::string& check, const T replace)
-    {
-        SpliceString(in, check, std::string(replace));
-    }
+    // Returns views into string, which must outlive them
+    std::vector<std::string_view> Split(std::string_view string, std::string_view splitter);
+    // Splits on any of delimiters in one pass; returns views into string, which must outlive them
+    std::vector<std::string_view> SplitAny(std::string_view string, const CharacterSet& delimiters, SplitAnyOptions options = {});
 
     namespace detail
     {
         template<class T>
         T FromStringImpl(const std::string& arg, const TypeIdentity<T>& t)
         {
-            ::std::istringstream stream(arg);
-
-            T toReturn;
-            stream >> toReturn;
-            return toReturn;
+            if constexpr (::std::is_arithmetic_v<T>)
+                return FromCharsSaturating<T>(arg, NegativeUnsigned::Wrap);
+            else
+            {
+                ::std::istringstream stream(arg);
+
+                T toReturn;
+                stream >> toReturn;
+                return toReturn;
+            }
         }
 
         std::string FromStringImpl(const std::string& arg, const TypeIdentity<std::string>& t);
     }
 
+    // Arithmetic types are parsed leniently: leading whitespace is skipped, parsing stops at the first bad character,
+    // unparseable text gives 0 and out of range values saturate
+    // Negative text wraps for unsigned types, so "-1" gives the maximum, except for unsigned char and short which give 0
+    // Use FromChars to have errors reported instead
     template<class T, typename ::std::enable_if<!::std::is_enum<T>::value, int>::type = 0>
     T FromString(const std::string& arg)
     {
         return detail::FromStringImpl(arg, ::Chroma::TypeIdentity<T>{});
     }
 
+    // Enums with EnumNameTraits are parsed by name first, then as their underlying number
     template<class T, typename ::std::enable_if<::std::is_enum<T>::value, int>::type = 0>
     T FromString(const std::string& arg)
     {
-        return static_cast<T>(FromString<::std::underlying_type<T>::type>(arg));
+        if constexpr (detail::HasEnumNames<T>)
+        {
+            if (const auto named = EnumFromName<T>(arg))
+                return *named;
+        }
+
+        return static_cast<T>(FromString<typename ::std::underlying_type<T>::type>(arg));
     }
 
     template<> char FromString(const std::string& arg);
@@ -132,9 +171,31 @@ namespace Chroma
     template<class T>
     std::string ToString(T arg)
     {
-        std::ostringstream s;
-        s << arg;
-        return std::string(s.str());
+        if constexpr (detail::IsCharConvertible<T>)
+        {
+            char buffer[MaxChars<T>];
+            return std::string(buffer, detail::NumberToChars(buffer, arg));
+        }
+        else if constexpr (detail::HasEnumNames<T>)
+        {
+            // Values without a name fall back to their number
+            const auto name = EnumName(arg);
+            return name.empty() ? ToString(static_cast<typename ::std::underlying_type<T>::type>(arg)) : std::string(name);
+        }
+        else
+        {
+            std::ostringstream s;
+            s << arg;
+            return std::string(s.str());
+        }
+    }
+
+    template<class T, typename ::std::enable_if<::std::is_floating_point_v<T>, int>::type = 0>
+    std::string ToString(T arg, FloatFormat format)
+    {
+        std::string output;
+        AppendChars(output, arg, format);
+        return output;
     }
 
     std::string ToString(char arg);
@@ -0,0 +1,569 @@
+#include "Unicode.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "DetailedException.h"
+#include "StringUtility.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CHROMA_UNICODE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Chroma
+{
+    namespace
+    {
+        constexpr auto npos = std::string_view::npos;
+
+        bool IsContinuation(std::uint8_t byte)
+        {
+            return (byte & 0xC0) == 0x80;
+        }
+
+        bool IsHighSurrogate(char32_t unit)
+        {
+            return unit >= 0xD800 && unit <= 0xDBFF;
+        }
+
+        bool IsLowSurrogate(char32_t unit)
+        {
+            return unit >= 0xDC00 && unit <= 0xDFFF;
+        }
+
+        bool IsScalarValue(char32_t codePoint)
+        {
+            return codePoint <= 0x10FFFF && !(codePoint >= 0xD800 && codePoint <= 0xDFFF);
+        }
+
+        // Decodes the sequence at position; returns its length, or 0 if it is invalid
+        size_t DecodeUtf8(std::string_view input, size_t position, char32_t& codePoint)
+        {
+            const auto at = [&](size_t offset) { return static_cast<std::uint8_t>(input[position + offset]); };
+            const auto remaining = input.size() - position;
+            const auto lead = at(0);
+            if (lead < 0x80)
+            {
+                codePoint = lead;
+                return 1;
+            }
+
+            if (lead >= 0xC2 && lead <= 0xDF)
+            {
+                if (remaining < 2 || !IsContinuation(at(1)))
+                    return 0;
+                codePoint = (char32_t(lead & 0x1F) << 6) | (at(1) & 0x3F);
+                return 2;
+            }
+
+            if (lead >= 0xE0 && lead <= 0xEF)
+            {
+                if (remaining < 3 || !IsContinuation(at(1)) || !IsContinuation(at(2)))
+                    return 0;
+                // Rule out overlong forms and surrogates
+                if ((lead == 0xE0 && at(1) < 0xA0) || (lead == 0xED && at(1) > 0x9F))
+                    return 0;
+                codePoint = (char32_t(lead & 0x0F) << 12) | (char32_t(at(1) & 0x3F) << 6) | (at(2) & 0x3F);
+                return 3;
+            }
+
+            if (lead >= 0xF0 && lead <= 0xF4)
+            {
+                if (remaining < 4 || !IsContinuation(at(1)) || !IsContinuation(at(2)) || !IsContinuation(at(3)))
+                    return 0;
+                // Rule out overlong forms and values past U+10FFFF
+                if ((lead == 0xF0 && at(1) < 0x90) || (lead == 0xF4 && at(1) > 0x8F))
+                    return 0;
+                codePoint = (char32_t(lead & 0x07) << 18) | (char32_t(at(1) & 0x3F) << 12) | (char32_t(at(2) & 0x3F) << 6) | (at(3) & 0x3F);
+                return 4;
+            }
+
+            return 0;
+        }
+
+        size_t EncodeUtf8(char32_t codePoint, char* output)
+        {
+            if (codePoint < 0x80)
+            {
+                output[0] = static_cast<char>(codePoint);
+                return 1;
+            }
+
+            if (codePoint < 0x800)
+            {
+                output[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+                output[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+
+            if (codePoint < 0x10000)
+            {
+                output[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+                output[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                output[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+
+            output[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+            output[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            output[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            output[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+
+        template<class Unit>
+        size_t EncodeUtf16(char32_t codePoint, Unit* output)
+        {
+            if (codePoint < 0x10000)
+            {
+                output[0] = static_cast<Unit>(codePoint);
+                return 1;
+            }
+
+            codePoint -= 0x10000;
+            output[0] = static_cast<Unit>(0xD800 | (codePoint >> 10));
+            output[1] = static_cast<Unit>(0xDC00 | (codePoint & 0x3FF));
+            return 2;
+        }
+
+        // Decodes the code point at position; returns its length in units, or 0 if it is invalid
+        template<class Unit>
+        size_t DecodeUtf16(const Unit* input, size_t size, size_t position, char32_t& codePoint)
+        {
+            const auto unit = static_cast<char32_t>(input[position]);
+            if (IsLowSurrogate(unit))
+                return 0;
+
+            if (!IsHighSurrogate(unit))
+            {
+                codePoint = unit;
+                return 1;
+            }
+
+            if (position + 1 >= size)
+                return 0;
+
+            const auto low = static_cast<char32_t>(input[position + 1]);
+            if (!IsLowSurrogate(low))
+                return 0;
+
+            codePoint = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+            return 2;
+        }
+
+        // The ASCII runs of each conversion are widened or narrowed a register at a time;
+        // each returns how many units it handled from position
+#if defined(CHROMA_UNICODE_SSE2)
+        template<class Unit>
+        size_t WidenAscii(std::string_view input, size_t position, Unit* output)
+        {
+            const auto start = position;
+            const auto zero = _mm_setzero_si128();
+            for (; position + 16 <= input.size(); position += 16)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + position));
+                if (_mm_movemask_epi8(block) != 0)
+                    break;
+
+                auto out = output + (position - start);
+                const auto low = _mm_unpacklo_epi8(block, zero);
+                const auto high = _mm_unpackhi_epi8(block, zero);
+                if constexpr (sizeof(Unit) == 2)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), low);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), high);
+                }
+                else
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(high, zero));
+                }
+            }
+
+            return position - start;
+        }
+
+        template<class Unit>
+        size_t NarrowAscii(const Unit* input, size_t size, size_t position, char* output)
+        {
+            constexpr size_t width = 16 / sizeof(Unit);
+            const auto start = position;
+            const auto nonAscii = sizeof(Unit) == 2 ? _mm_set1_epi16(static_cast<short>(0xFF80)) : _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            for (; position + width <= size; position += width)
+            {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + position));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(block, nonAscii), _mm_setzero_si128())) != 0xFFFF)
+                    break;
+
+                auto packed = block;
+                if constexpr (sizeof(Unit) == 4)
+                    packed = _mm_packs_epi32(packed, packed);
+                packed = _mm_packus_epi16(packed, packed);
+
+                auto out = output + (position - start);
+                if constexpr (sizeof(Unit) == 2)
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), packed);
+                else
+                {
+                    const auto word = _mm_cvtsi128_si32(packed);
+                    std::memcpy(out, &word, sizeof(word));
+                }
+            }
+
+            return position - start;
+        }
+#else
+        template<class Unit>
+        size_t WidenAscii(std::string_view input, size_t position, Unit* output)
+        {
+            return 0;
+        }
+
+        template<class Unit>
+        size_t NarrowAscii(const Unit* input, size_t size, size_t position, char* output)
+        {
+            return 0;
+        }
+#endif
+
+        template<class Unit>
+        TranscodeResult Utf8ToUtf16Impl(std::string_view input, Unit* output)
+        {
+            TranscodeResult result;
+            size_t position = 0;
+            while (position < input.size())
+            {
+                const auto ascii = WidenAscii(input, position, output + result.written);
+                position += ascii;
+                result.written += ascii;
+                if (position == input.size())
+                    break;
+
+                char32_t codePoint;
+                const auto length = DecodeUtf8(input, position, codePoint);
+                if (length == 0)
+                {
+                    result.error = position;
+                    break;
+                }
+
+                position += length;
+                result.written += EncodeUtf16(codePoint, output + result.written);
+            }
+
+            return result;
+        }
+
+        template<class Unit>
+        TranscodeResult Utf8ToUtf32Impl(std::string_view input, Unit* output)
+        {
+            TranscodeResult result;
+            size_t position = 0;
+            while (position < input.size())
+            {
+                const auto ascii = WidenAscii(input, position, output + result.written);
+                position += ascii;
+                result.written += ascii;
+                if (position == input.size())
+                    break;
+
+                char32_t codePoint;
+                const auto length = DecodeUtf8(input, position, codePoint);
+                if (length == 0)
+                {
+                    result.error = position;
+                    break;
+                }
+
+                position += length;
+                output[result.written++] = static_cast<Unit>(codePoint);
+            }
+
+            return result;
+        }
+
+        template<class Unit>
+        TranscodeResult Utf16ToUtf8Impl(const Unit* input, size_t size, char* output)
+        {
+            TranscodeResult result;
+            size_t position = 0;
+            while (position < size)
+            {
+                const auto ascii = NarrowAscii(input, size, position, output + result.written);
+                position += ascii;
+                result.written += ascii;
+                if (position == size)
+                    break;
+
+                char32_t codePoint;
+                const auto length = DecodeUtf16(input, size, position, codePoint);
+                if (length == 0)
+                {
+                    result.error = position;
+                    break;
+                }
+
+                position += length;
+                result.written += EncodeUtf8(codePoint, output + result.written);
+            }
+
+            return result;
+        }
+
+        template<class Unit>
+        TranscodeResult Utf32ToUtf8Impl(const Unit* input, size_t size, char* output)
+        {
+            TranscodeResult result;
+            size_t position = 0;
+            while (position < size)
+            {
+                const auto ascii = NarrowAscii(input, size, position, output + result.written);
+                position += ascii;
+                result.written += ascii;
+                if (position == size)
+                    break;
+
+                const auto codePoint = static_cast<char32_t>(input[position]);
+                if (!IsScalarValue(codePoint))
+                {
+                    result.error = position;
+                    break;
+                }
+
+                ++position;
+                result.written += EncodeUtf8(codePoint, output + result.written);
+            }
+
+            return result;
+        }
+
+        template<class Unit>
+        size_t Utf16ToUtf8LengthImpl(const Unit* input, size_t size)
+        {
+            size_t length = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const auto unit = static_cast<char32_t>(input[i]);
+                // Each half of a surrogate pair accounts for 2 of the pair's 4 bytes
+                length += unit < 0x80 ? 1 : unit < 0x800 ? 2 : (unit >= 0xD800 && unit <= 0xDFFF) ? 2 : 3;
+            }
+
+            return length;
+        }
+
+        template<class Unit>
+        size_t Utf32ToUtf8LengthImpl(const Unit* input, size_t size)
+        {
+            size_t length = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const auto unit = static_cast<char32_t>(input[i]);
+                length += unit < 0x80 ? 1 : unit < 0x800 ? 2 : unit < 0x10000 ? 3 : 4;
+            }
+
+            return length;
+        }
+
+        void ThrowIfInvalid(const TranscodeResult& result, const std::string& message)
+        {
+            if (!result)
+                throw DetailedException(message, { { "Position", ToString(result.error) } });
+        }
+
+        template<class Unit>
+        std::string ToUtf8Impl(const Unit* input, size_t size, const std::string& message)
+        {
+            std::string output;
+            if constexpr (sizeof(Unit) == 2)
+            {
+                output.resize(Utf16ToUtf8LengthImpl(input, size));
+                const auto result = Utf16ToUtf8Impl(input, size, output.data());
+                ThrowIfInvalid(result, message);
+            }
+            else
+            {
+                output.resize(Utf32ToUtf8LengthImpl(input, size));
+                const auto result = Utf32ToUtf8Impl(input, size, output.data());
+                ThrowIfInvalid(result, message);
+            }
+
+            return output;
+        }
+    }
+
+    size_t Utf8ToUtf16Length(std::string_view input)
+    {
+        size_t length = 0;
+        for (auto character : input)
+        {
+            const auto byte = static_cast<std::uint8_t>(character);
+            // Lead bytes start a unit, and four byte leads need a surrogate pair
+            length += !IsContinuation(byte) + (byte >= 0xF0);
+        }
+
+        return length;
+    }
+
+    size_t Utf8ToUtf32Length(std::string_view input)
+    {
+        size_t length = 0;
+        for (auto character : input)
+            length += !IsContinuation(static_cast<std::uint8_t>(character));
+        return length;
+    }
+
+    size_t Utf16ToUtf8Length(std::u16string_view input)
+    {
+        return Utf16ToUtf8LengthImpl(input.data(), input.size());
+    }
+
+    size_t Utf16ToUtf32Length(std::u16string_view input)
+    {
+        size_t length = 0;
+        for (auto unit : input)
+            length += !IsLowSurrogate(unit);
+        return length;
+    }
+
+    size_t Utf32ToUtf8Length(std::u32string_view input)
+    {
+        return Utf32ToUtf8LengthImpl(input.data(), input.size());
+    }
+
+    size_t Utf32ToUtf16Length(std::u32string_view input)
+    {
+        size_t length = 0;
+        for (auto unit : input)
+            length += unit < 0x10000 ? 1 : 2;
+        return length;
+    }
+
+    TranscodeResult Utf8ToUtf16(std::string_view input, char16_t* output)
+    {
+        return Utf8ToUtf16Impl(input, output);
+    }
+
+    TranscodeResult Utf8ToUtf32(std::string_view input, char32_t* output)
+    {
+        return Utf8ToUtf32Impl(input, output);
+    }
+
+    TranscodeResult Utf16ToUtf8(std::u16string_view input, char* output)
+    {
+        return Utf16ToUtf8Impl(input.data(), input.size(), output);
+    }
+
+    TranscodeResult Utf16ToUtf32(std::u16string_view input, char32_t* output)
+    {
+        TranscodeResult result;
+        size_t position = 0;
+        while (position < input.size())
+        {
+            char32_t codePoint;
+            const auto length = DecodeUtf16(input.data(), input.size(), position, codePoint);
+            if (length == 0)
+            {
+                result.error = position;
+                break;
+            }
+
+            position += length;
+            output[result.written++] = codePoint;
+        }
+
+        return result;
+    }
+
+    TranscodeResult Utf32ToUtf8(std::u32string_view input, char* output)
+    {
+        return Utf32ToUtf8Impl(input.data(), input.size(), output);
+    }
+
+    TranscodeResult Utf32ToUtf16(std::u32string_view input, char16_t* output)
+    {
+        TranscodeResult result;
+        for (size_t position = 0; position < input.size(); ++position)
+        {
+            if (!IsScalarValue(input[position]))
+            {
+                result.error = position;
+                break;
+            }
+
+            result.written += EncodeUtf16(input[position], output + result.written);
+        }
+
+        return result;
+    }
+
+    bool IsValidUtf8(std::string_view input)
+    {
+        size_t position = 0;
+        while (position < input.size())
+        {
+#if defined(CHROMA_UNICODE_SSE2)
+            if (position + 16 <= input.size() &&
+                _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + position))) == 0)
+            {
+                position += 16;
+                continue;
+            }
+#endif
+            char32_t codePoint;
+            const auto length = DecodeUtf8(input, position, codePoint);
+            if (length == 0)
+                return false;
+            position += length;
+        }
+
+        return true;
+    }
+
+    std::u16string ToUtf16(std::string_view input)
+    {
+        std::u16string output(Utf8ToUtf16Length(input), u'\0');
+        ThrowIfInvalid(Utf8ToUtf16(input, output.data()), "Invalid UTF-8.");
+        return output;
+    }
+
+    std::u32string ToUtf32(std::string_view input)
+    {
+        std::u32string output(Utf8ToUtf32Length(input), U'\0');
+        ThrowIfInvalid(Utf8ToUtf32(input, output.data()), "Invalid UTF-8.");
+        return output;
+    }
+
+    std::string ToUtf8(std::u16string_view input)
+    {
+        return ToUtf8Impl(input.data(), input.size(), "Invalid UTF-16.");
+    }
+
+    std::string ToUtf8(std::u32string_view input)
+    {
+        return ToUtf8Impl(input.data(), input.size(), "Invalid UTF-32.");
+    }
+
+    std::string ToUtf8(std::wstring_view input)
+    {
+        return ToUtf8Impl(input.data(), input.size(), sizeof(wchar_t) == 2 ? "Invalid UTF-16." : "Invalid UTF-32.");
+    }
+
+    std::wstring ToWide(std::string_view input)
+    {
+        if constexpr (sizeof(wchar_t) == 2)
+        {
+            std::wstring output(Utf8ToUtf16Length(input), L'\0');
+            ThrowIfInvalid(Utf8ToUtf16Impl(input, output.data()), "Invalid UTF-8.");
+            return output;
+        }
+        else
+        {
+            std::wstring output(Utf8ToUtf32Length(input), L'\0');
+            ThrowIfInvalid(Utf8ToUtf32Impl(input, output.data()), "Invalid UTF-8.");
+            return output;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace Chroma
+{
+    struct TranscodeResult
+    {
+        // Code units written to the output
+        size_t written = 0;
+        // Position in the input of the first invalid sequence, or npos if the input was valid
+        size_t error = std::string_view::npos;
+
+        [[nodiscard]] explicit operator bool() const
+        {
+            return error == std::string_view::npos;
+        }
+    };
+
+    // Code units the conversion of valid input produces, for sizing the output up front
+    [[nodiscard]] size_t Utf8ToUtf16Length(std::string_view input);
+    [[nodiscard]] size_t Utf8ToUtf32Length(std::string_view input);
+    [[nodiscard]] size_t Utf16ToUtf8Length(std::u16string_view input);
+    [[nodiscard]] size_t Utf16ToUtf32Length(std::u16string_view input);
+    [[nodiscard]] size_t Utf32ToUtf8Length(std::u32string_view input);
+    [[nodiscard]] size_t Utf32ToUtf16Length(std::u32string_view input);
+
+    // Transcoders validate as they go and stop at the first invalid sequence
+    // Overlong encodings, surrogate code points and values past U+10FFFF are all invalid
+    // output needs room for the matching Length function's result
+    TranscodeResult Utf8ToUtf16(std::string_view input, char16_t* output);
+    TranscodeResult Utf8ToUtf32(std::string_view input, char32_t* output);
+    TranscodeResult Utf16ToUtf8(std::u16string_view input, char* output);
+    TranscodeResult Utf16ToUtf32(std::u16string_view input, char32_t* output);
+    TranscodeResult Utf32ToUtf8(std::u32string_view input, char* output);
+    TranscodeResult Utf32ToUtf16(std::u32string_view input, char16_t* output);
+
+    [[nodiscard]] bool IsValidUtf8(std::string_view input);
+
+    // These throw DetailedException on invalid input
+    std::u16string ToUtf16(std::string_view input);
+    std::u32string ToUtf32(std::string_view input);
+    std::string ToUtf8(std::u16string_view input);
+    std::string ToUtf8(std::u32string_view input);
+    // wchar_t holds UTF-16 where it is 2 bytes, as on Windows, and UTF-32 where it is 4
+    std::string ToUtf8(std::wstring_view input);
+    std::wstring ToWide(std::string_view input);
+}
\ No newline at end of file
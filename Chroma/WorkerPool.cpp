@@ -0,0 +1,94 @@
+#include "WorkerPool.h"
+
+namespace Chroma
+{
+    namespace
+    {
+        thread_local const WorkerPool* currentPool = nullptr;
+        thread_local size_t currentIndex = 0;
+    }
+
+    WorkerPool::WorkerPool(size_t threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = 1;
+
+        queues.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            queues.push_back(std::make_unique<Queue>());
+
+        threads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            threads.emplace_back([this, i]() { Work(i); });
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        stopping = true;
+        ++signal;
+        signal.notify_all();
+
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    void WorkerPool::Post(Task task)
+    {
+        const auto index = currentPool == this
+            ? currentIndex
+            : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+        {
+            auto& queue = *queues[index];
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        ++signal;
+        signal.notify_one();
+    }
+
+    size_t WorkerPool::ThreadCount() const
+    {
+        return threads.size();
+    }
+
+    void WorkerPool::Work(size_t index)
+    {
+        currentPool = this;
+        currentIndex = index;
+
+        Task task;
+        while (true)
+        {
+            // Read before looking for work so a post landing after the search still wakes this worker
+            const auto seen = signal.load();
+            if (TryTake(index, task))
+            {
+                task();
+                task = nullptr;
+            }
+            else if (stopping)
+                return;
+            else
+                signal.wait(seen);
+        }
+    }
+
+    bool WorkerPool::TryTake(size_t index, Task& task)
+    {
+        for (size_t offset = 0; offset < queues.size(); ++offset)
+        {
+            auto& queue = *queues[(index + offset) % queues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace Chroma
+{
+    // Fixed set of threads that run posted tasks in no particular order
+    // Each worker has its own queue and steals from the others when it runs dry, so posting never contends on a pool-wide lock
+    class WorkerPool
+    {
+    public:
+        using Task = std::function<void()>;
+    public:
+        explicit WorkerPool(size_t threadCount = std::thread::hardware_concurrency());
+        WorkerPool(const WorkerPool& arg) = delete;
+        WorkerPool(WorkerPool&& arg) = delete;
+        // Runs every task still queued before joining
+        ~WorkerPool();
+        WorkerPool& operator=(const WorkerPool& arg) = delete;
+        WorkerPool& operator=(WorkerPool&& arg) = delete;
+
+        // Posting from a worker queues onto that worker, otherwise queues are picked round robin
+        void Post(Task task);
+
+        [[nodiscard]] size_t ThreadCount() const;
+    private:
+        struct alignas(64) Queue
+        {
+            std::deque<Task> tasks;
+            std::mutex mutex;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> threads;
+
+        std::atomic<size_t> nextQueue = 0;
+        // Bumped on every post so idle workers can sleep on it without missing one
+        std::atomic<std::uint32_t> signal = 0;
+        std::atomic<bool> stopping = false;
+
+        void Work(size_t index);
+        [[nodiscard]] bool TryTake(size_t index, Task& task);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <limits>
+#include <cstdlib>
+#include <type_traits>
+
+// The implementations StringUtility had before it was optimized, kept verbatim as the reference for benchmarks and fuzzing
+namespace Baseline
+{
+    template<class String>
+    size_t CountInstances(const String& input, const String& of)
+    {
+        size_t instances = 0;
+        const auto instanceSize = of.size();
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            const auto substring = input.substr(i, instanceSize);
+            if (substring == of)
+                ++instances;
+        }
+
+        return instances;
+    }
+
+    // Never returns for an empty splitter
+    template<class String>
+    std::vector<String> Split(const String& string, const String& splitter)
+    {
+        if (string.empty())
+            return {};
+
+        auto manipulateString = string;
+        auto splitterPosition = manipulateString.find(splitter);
+        if (splitterPosition == String::npos)
+            return { manipulateString };
+
+        std::vector<String> returnValue;
+        returnValue.reserve(CountInstances(string, splitter));
+
+        while (splitterPosition != String::npos)
+        {
+            auto substr = manipulateString.substr(0, splitterPosition);
+            if (!substr.empty())
+                returnValue.push_back(substr);
+            manipulateString.erase(0, splitterPosition + splitter.size());
+            splitterPosition = manipulateString.find(splitter);
+        }
+
+        if (!manipulateString.empty())
+            returnValue.push_back(manipulateString);
+
+        return returnValue;
+    }
+
+    // Never returns for an empty instance and an empty with
+    inline std::string ReplaceString(const std::string& string, const std::string& instance, const std::string& with)
+    {
+        const auto instanceSize = instance.size();
+        auto output = string;
+        for(size_t i = 0; i < output.size();)
+        {
+            const auto checkString = output.substr(i, instanceSize);
+            if (checkString != instance)
+            {
+                ++i;
+                continue;
+            }
+
+            output.replace(i, instanceSize, with);
+            i += with.size();
+        }
+
+        return output;
+    }
+
+    // Only trims spaces and newlines
+    inline std::string Trim(const std::string& trim)
+    {
+        if (trim.empty())
+            return trim;
+
+        std::string ret = trim;
+
+        while (ret[ret.size() - 1] == ' ' || ret[ret.size() - 1] == '\n')
+        {
+            ret.erase(ret.size() - 1, 1);
+
+            if (ret.empty())
+                return ret;
+        }
+
+        while (ret[0] == ' ' || ret[0] == '\n')
+            ret.erase(0, 1);
+
+        return ret;
+    }
+
+    namespace detail
+    {
+        template<class T>
+        T FromStringCommon(const std::string& arg)
+        {
+            long long returned = ::std::strtoll(arg.c_str(), nullptr, 10);
+            if (returned > ::std::numeric_limits<T>::max())
+                return ::std::numeric_limits<T>::max();
+            else if (returned < ::std::numeric_limits<T>::min())
+                return ::std::numeric_limits<T>::min();
+            else
+                return static_cast<T>(returned);
+        }
+    }
+
+    template<class T>
+    T FromString(const std::string& arg)
+    {
+        if constexpr (
+            std::is_same_v<T, char> ||
+            std::is_same_v<T, signed char> ||
+            std::is_same_v<T, unsigned char> ||
+            std::is_same_v<T, short> ||
+            std::is_same_v<T, unsigned short>)
+            return detail::FromStringCommon<T>(arg);
+        else
+        {
+            ::std::istringstream stream(arg);
+
+            // Initialized here so text the stream never reads from compares equal
+            T toReturn = T();
+            stream >> toReturn;
+            return toReturn;
+        }
+    }
+}
\ No newline at end of file
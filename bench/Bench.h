@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <type_traits>
+#include <cstdint>
+#include <cstring>
+
+namespace Bench
+{
+    inline volatile std::uint64_t sink = 0;
+
+    // Stops the optimizer from discarding results that are otherwise unused
+    template<class T>
+    void Consume(const T& value)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+            sink = bits;
+        }
+        else
+            sink = value.size();
+    }
+
+    // Runs function until at least minimumSeconds have passed and returns the average seconds per call
+    template<class Function>
+    double SecondsPerCall(Function function, double minimumSeconds = 0.2)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        size_t calls = 0;
+        const auto start = Clock::now();
+        auto elapsed = 0.0;
+        do
+        {
+            function();
+            ++calls;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (elapsed < minimumSeconds);
+
+        return elapsed / static_cast<double>(calls);
+    }
+
+    // A negative baselineSeconds means the baseline was skipped
+    inline void Report(std::string_view name, double baselineSeconds, double currentSeconds, double bytes)
+    {
+        const auto megabytesPerSecond = [bytes](double seconds) { return bytes / seconds / (1024.0 * 1024.0); };
+        if (baselineSeconds < 0)
+        {
+            std::printf(
+                "%-40.*s baseline        skipped  current %10.1f MB/s\n",
+                static_cast<int>(name.size()),
+                name.data(),
+                megabytesPerSecond(currentSeconds));
+            return;
+        }
+
+        std::printf(
+            "%-40.*s baseline %10.1f MB/s  current %10.1f MB/s  speedup %6.2fx\n",
+            static_cast<int>(name.size()),
+            name.data(),
+            megabytesPerSecond(baselineSeconds),
+            megabytesPerSecond(currentSeconds),
+            baselineSeconds / currentSeconds);
+    }
+}
\ No newline at end of file
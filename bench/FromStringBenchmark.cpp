@@ -0,0 +1,86 @@
+// Compares FromString and FromChars against the istringstream and strtoll based FromString they replaced
+// Build from the repository root, for example:
+//     g++ -std=c++20 -O2 -I. bench/FromStringBenchmark.cpp Chroma/StringUtility.cpp Chroma/CharacterSet.cpp Chroma/StringSearch.cpp
+//         Chroma/StringBuilder.cpp Chroma/CaseConversion.cpp Chroma/Unicode.cpp Chroma/DetailedException.cpp
+//         Chroma/NameValuePair.cpp Chroma/StringPool.cpp Chroma/SplitView.cpp -o FromStringBenchmark
+
+#include <vector>
+#include <string>
+#include <random>
+
+#include "Chroma/StringUtility.h"
+#include "bench/Baseline.h"
+#include "bench/Bench.h"
+
+namespace
+{
+    // Config and wire text: mostly short numbers, some negative, some with leading whitespace
+    template<class T>
+    std::vector<std::string> Corpus(size_t count)
+    {
+        std::mt19937_64 random(42);
+        std::vector<std::string> corpus;
+        corpus.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string text = random() % 8 == 0 ? " " : "";
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+                text += std::to_string(static_cast<T>(distribution(random)));
+            }
+            else
+            {
+                const auto magnitude = random() >> (random() % 64);
+                auto value = static_cast<T>(magnitude);
+                if constexpr (std::is_signed_v<T>)
+                    value = static_cast<T>(random() % 4 == 0 ? -(value / 2) : value / 2);
+                text += std::to_string(value);
+            }
+
+            corpus.push_back(std::move(text));
+        }
+
+        return corpus;
+    }
+
+    template<class T>
+    void Run(std::string_view name)
+    {
+        const auto corpus = Corpus<T>(4096);
+        double bytes = 0;
+        for (auto& text : corpus)
+            bytes += static_cast<double>(text.size());
+
+        const auto baseline = Bench::SecondsPerCall([&]()
+        {
+            for (auto& text : corpus)
+                Bench::Consume(Baseline::FromString<T>(text));
+        });
+        const auto fromString = Bench::SecondsPerCall([&]()
+        {
+            for (auto& text : corpus)
+                Bench::Consume(Chroma::FromString<T>(text));
+        });
+        const auto fromChars = Bench::SecondsPerCall([&]()
+        {
+            for (auto& text : corpus)
+                Bench::Consume(Chroma::FromChars<T>(text).value);
+        });
+
+        Bench::Report(std::string(name) + " FromString", baseline, fromString, bytes);
+        Bench::Report(std::string(name) + " FromChars", baseline, fromChars, bytes);
+    }
+}
+
+int main()
+{
+    Run<short>("short");
+    Run<int>("int");
+    Run<unsigned int>("unsigned int");
+    Run<long long>("long long");
+    Run<unsigned long long>("unsigned long long");
+    Run<float>("float");
+    Run<double>("double");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+// Times Split, CountInstances, ReplaceString, Trim and FromString against the implementations they replaced, kept in bench/Baseline.h,
+// on generated prose, CSV and log corpora from 16 bytes up to 1GB
+// Build from the repository root, for example:
+//     g++ -std=c++20 -O2 -I. bench/StringUtilityBenchmark.cpp Chroma/StringUtility.cpp Chroma/CharacterSet.cpp Chroma/StringSearch.cpp
+//         Chroma/StringBuilder.cpp Chroma/CaseConversion.cpp Chroma/Unicode.cpp Chroma/DetailedException.cpp
+//         Chroma/NameValuePair.cpp Chroma/StringPool.cpp Chroma/SplitView.cpp -o StringUtilityBenchmark
+// Usage: StringUtilityBenchmark [max size] [baseline limit] [quadratic baseline limit]
+// The baseline Split and ReplaceString are quadratic, so by default they stop at 256KB and the rest of the baseline at 64MB
+// Split at 1GB holds a view per token, which takes several GB
+
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "Chroma/StringUtility.h"
+#include "bench/Baseline.h"
+#include "bench/Bench.h"
+
+namespace
+{
+    struct Limits
+    {
+        size_t maxSize = size_t(1) << 30;
+        size_t baseline = size_t(64) << 20;
+        size_t quadraticBaseline = size_t(256) << 10;
+    };
+
+    struct Corpus
+    {
+        std::string name;
+        std::string text;
+        std::string separator;
+        std::string pattern;
+        std::string replacement;
+        bool numericFields = false;
+    };
+
+    // Words drawn with a skew towards the front of the list, loosely like natural text
+    Corpus Prose(size_t size)
+    {
+        static const std::vector<std::string_view> words =
+        {
+            "the", "of", "and", "to", "a", "in", "is", "it", "that", "was", "for", "on", "with", "as", "by", "at", "from",
+            "this", "be", "or", "which", "an", "are", "not", "but", "had", "have", "they", "were", "their", "one", "all",
+            "string", "buffer", "memory", "allocation", "performance", "throughput", "latency", "pattern", "character",
+            "utility", "benchmark", "corpus", "implementation", "quadratic", "linear", "vectorized", "boundary"
+        };
+
+        std::mt19937_64 random(1);
+        Corpus corpus{ "prose", {}, " ", "the", "THE_WORD" };
+        corpus.text.reserve(size + 32);
+        size_t lineWords = 0;
+        while (corpus.text.size() < size)
+        {
+            if (lineWords == 0 && random() % 4 == 0)
+                corpus.text += "    ";
+
+            corpus.text += words[random() % (random() % words.size() + 1)];
+            if (++lineWords == 12)
+            {
+                corpus.text += ".\n";
+                lineWords = 0;
+            }
+            else
+                corpus.text += ' ';
+        }
+
+        corpus.text.resize(size);
+        return corpus;
+    }
+
+    Corpus Csv(size_t size)
+    {
+        std::mt19937_64 random(2);
+        Corpus corpus{ "csv", {}, ",", ",", ";", true };
+        corpus.text.reserve(size + 64);
+        for (size_t row = 0; corpus.text.size() < size; ++row)
+        {
+            corpus.text += std::to_string(row);
+            corpus.text += random() % 2 ? ", " : ",";
+            corpus.text += std::to_string(static_cast<long long>(random() % 2000000) - 1000000);
+            corpus.text += ',';
+            corpus.text += std::to_string(random() % 100000);
+            corpus.text += '.';
+            corpus.text += std::to_string(random() % 100);
+            corpus.text += ",";
+            corpus.text += std::to_string(random() % 256);
+            corpus.text += '\n';
+        }
+
+        corpus.text.resize(size);
+        return corpus;
+    }
+
+    Corpus Log(size_t size)
+    {
+        static const std::vector<std::string_view> levels = { "INFO ", "INFO ", "INFO ", "DEBUG", "WARN ", "ERROR" };
+        static const std::vector<std::string_view> messages =
+        {
+            "request completed", "cache miss for key", "connection reset by peer", "retrying after backoff",
+            "flushed buffers to disk", "slow query detected"
+        };
+
+        std::mt19937_64 random(3);
+        Corpus corpus{ "log", {}, "\n", "ERROR", "E" };
+        corpus.text.reserve(size + 128);
+        for (size_t line = 0; corpus.text.size() < size; ++line)
+        {
+            corpus.text += "2024-05-01T12:";
+            corpus.text += std::to_string(10 + line / 60 % 50);
+            corpus.text += ':';
+            corpus.text += std::to_string(10 + line % 50);
+            corpus.text += ".123Z ";
+            corpus.text += levels[random() % levels.size()];
+            corpus.text += " [worker-";
+            corpus.text += std::to_string(random() % 16);
+            corpus.text += "] ";
+            corpus.text += messages[random() % messages.size()];
+            corpus.text += " in ";
+            corpus.text += std::to_string(random() % 1000);
+            corpus.text += " ms  \n";
+        }
+
+        corpus.text.resize(size);
+        return corpus;
+    }
+
+    std::string SizeName(size_t size)
+    {
+        if (size >= (size_t(1) << 30))
+            return std::to_string(size >> 30) + "GB";
+        if (size >= (size_t(1) << 20))
+            return std::to_string(size >> 20) + "MB";
+        if (size >= (size_t(1) << 10))
+            return std::to_string(size >> 10) + "KB";
+        return std::to_string(size) + "B";
+    }
+
+    // Returns -1 if size is past limit, which Report shows as skipped
+    template<class Function>
+    double BaselineSecondsPerCall(size_t size, size_t limit, Function function)
+    {
+        return size <= limit ? Bench::SecondsPerCall(function) : -1;
+    }
+
+    void Run(const Corpus& full, size_t size, const Limits& limits)
+    {
+        const std::string text = full.text.substr(0, size);
+        const std::string_view view = text;
+        const auto bytes = static_cast<double>(size);
+        const auto prefix = full.name + " " + SizeName(size) + " ";
+
+        Bench::Report(
+            prefix + "Split",
+            BaselineSecondsPerCall(size, limits.quadraticBaseline, [&]() { Bench::Consume(Baseline::Split(text, full.separator)); }),
+            Bench::SecondsPerCall([&]() { Bench::Consume(Chroma::Split(view, std::string_view(full.separator))); }),
+            bytes);
+
+        Bench::Report(
+            prefix + "CountInstances",
+            BaselineSecondsPerCall(size, limits.baseline, [&]() { Bench::Consume(Baseline::CountInstances(text, full.pattern)); }),
+            Bench::SecondsPerCall([&]() { Bench::Consume(Chroma::CountInstances(text, full.pattern)); }),
+            bytes);
+
+        Bench::Report(
+            prefix + "ReplaceString",
+            BaselineSecondsPerCall(size, limits.quadraticBaseline, [&]() { Bench::Consume(Baseline::ReplaceString(text, full.pattern, full.replacement)); }),
+            Bench::SecondsPerCall([&]() { Bench::Consume(Chroma::ReplaceString(view, full.pattern, full.replacement)); }),
+            bytes);
+
+        // Trimming is done a line at a time, the way it's used on parsed text
+        const auto lineViews = Chroma::Split(view, std::string_view("\n"));
+        std::vector<std::string> lines;
+        if (size <= limits.baseline)
+            lines.assign(lineViews.begin(), lineViews.end());
+        Bench::Report(
+            prefix + "Trim each line",
+            BaselineSecondsPerCall(size, limits.baseline, [&]()
+            {
+                for (auto& line : lines)
+                    Bench::Consume(Baseline::Trim(line));
+            }),
+            Bench::SecondsPerCall([&]()
+            {
+                for (auto line : lineViews)
+                    Bench::Consume(Chroma::Trim(line));
+            }),
+            bytes);
+
+        if (full.numericFields)
+        {
+            std::vector<std::string> fields;
+            for (auto line : lineViews)
+                for (auto field : Chroma::Split(line, std::string_view(",")))
+                    fields.emplace_back(field);
+
+            Bench::Report(
+                prefix + "FromString<double> each field",
+                BaselineSecondsPerCall(size, limits.baseline, [&]()
+                {
+                    for (auto& field : fields)
+                        Bench::Consume(Baseline::FromString<double>(field));
+                }),
+                Bench::SecondsPerCall([&]()
+                {
+                    for (auto& field : fields)
+                        Bench::Consume(Chroma::FromString<double>(field));
+                }),
+                bytes);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Limits limits;
+    if (argc > 1)
+        limits.maxSize = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2)
+        limits.baseline = std::strtoull(argv[2], nullptr, 10);
+    if (argc > 3)
+        limits.quadraticBaseline = std::strtoull(argv[3], nullptr, 10);
+
+    // Each corpus is generated once at the largest size, and smaller sizes are its prefixes
+    for (const auto generate : { &Prose, &Csv, &Log })
+    {
+        const auto corpus = generate(limits.maxSize);
+        for (size_t size = 16; size <= limits.maxSize; size *= 4)
+            Run(corpus, size, limits);
+    }
+
+    return 0;
+}
\ No newline at end of file
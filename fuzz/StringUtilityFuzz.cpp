@@ -0,0 +1,170 @@
+// Differential fuzzer: checks StringUtility against the implementations it replaced, kept in bench/Baseline.h
+// Build with libFuzzer from the repository root, for example:
+//     clang++ -std=c++20 -g -O1 -fsanitize=fuzzer,address,undefined -I. fuzz/StringUtilityFuzz.cpp Chroma/StringUtility.cpp
+//         Chroma/CharacterSet.cpp Chroma/StringSearch.cpp Chroma/StringBuilder.cpp Chroma/CaseConversion.cpp Chroma/Unicode.cpp
+//         Chroma/DetailedException.cpp Chroma/NameValuePair.cpp Chroma/StringPool.cpp Chroma/SplitView.cpp -o StringUtilityFuzz
+// Defining CHROMA_FUZZ_STANDALONE adds a main for compilers without libFuzzer, which replays the files it's given
+// or otherwise runs random inputs
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Chroma/StringUtility.h"
+#include "bench/Baseline.h"
+
+namespace
+{
+    void Check(bool condition, const char* what)
+    {
+        if (condition)
+            return;
+
+        std::fprintf(stderr, "Mismatch with baseline: %s\n", what);
+        std::abort();
+    }
+
+    // Takes a length byte and then that many bytes off the front of input
+    std::string TakePrefixed(std::string_view& input)
+    {
+        if (input.empty())
+            return {};
+
+        const auto size = std::min<size_t>(static_cast<std::uint8_t>(input[0]) % 16, input.size() - 1);
+        std::string taken(input.substr(1, size));
+        input.remove_prefix(1 + size);
+        return taken;
+    }
+
+    void CheckSplit(const std::string& input, const std::string& splitter)
+    {
+        // The baseline never returns for an empty splitter
+        if (splitter.empty())
+            return;
+
+        const auto expected = Baseline::Split(input, splitter);
+        const auto views = Chroma::Split(std::string_view(input), std::string_view(splitter));
+        Check(std::vector<std::string>(views.begin(), views.end()) == expected, "Split");
+        Check(Chroma::Split(input, splitter) == expected, "Split<std::string>");
+    }
+
+    void CheckCountInstances(const std::string& input, const std::string& of)
+    {
+        const auto expected = Baseline::CountInstances(input, of);
+        Check(Chroma::CountInstances(input, of) == expected, "CountInstances");
+        Check(Chroma::CountInstances(input, Chroma::StringSearcher(of)) == expected, "CountInstances with StringSearcher");
+        Check(Chroma::Contains(input, of) == (expected > 0), "Contains");
+    }
+
+    void CheckReplaceString(const std::string& input, const std::string& instance, const std::string& with)
+    {
+        // The baseline never returns for an empty instance
+        if (instance.empty())
+            return;
+
+        const auto expected = Baseline::ReplaceString(input, instance, with);
+        Check(Chroma::ReplaceString(input, instance, with) == expected, "ReplaceString");
+        Check(Chroma::ReplaceString(input, Chroma::StringSearcher(instance), with) == expected, "ReplaceString with StringSearcher");
+    }
+
+    void CheckTrim(const std::string& input)
+    {
+        // The baseline only trimmed spaces and newlines
+        const Chroma::CharacterSet spaceOrNewline(" \n");
+        const auto expected = Baseline::Trim(input);
+        Check(Chroma::Trim(input, spaceOrNewline) == expected, "Trim");
+        Check(Chroma::Trim(std::string_view(input), spaceOrNewline) == expected, "Trim on a view");
+
+        auto inPlace = input;
+        Chroma::TrimInPlace(inPlace, spaceOrNewline);
+        Check(inPlace == expected, "TrimInPlace");
+    }
+
+    template<class T>
+    void CheckFromString(const std::string& input)
+    {
+        Check(Chroma::FromString<T>(input) == Baseline::FromString<T>(input), "FromString");
+    }
+
+    void CheckFromString(const std::string& input)
+    {
+        CheckFromString<char>(input);
+        CheckFromString<signed char>(input);
+        CheckFromString<unsigned char>(input);
+        CheckFromString<short>(input);
+        CheckFromString<unsigned short>(input);
+        CheckFromString<int>(input);
+        CheckFromString<unsigned int>(input);
+        CheckFromString<long long>(input);
+        CheckFromString<unsigned long long>(input);
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, size_t size)
+{
+    if (size == 0)
+        return 0;
+
+    const auto operation = data[0] % 5;
+    std::string_view rest(reinterpret_cast<const char*>(data) + 1, size - 1);
+    const auto pattern = TakePrefixed(rest);
+    const auto with = TakePrefixed(rest);
+    const std::string input(rest);
+
+    switch (operation)
+    {
+    case 0:
+        CheckSplit(input, pattern);
+        break;
+    case 1:
+        CheckCountInstances(input, pattern);
+        break;
+    case 2:
+        CheckReplaceString(input, pattern, with);
+        break;
+    case 3:
+        CheckTrim(input);
+        break;
+    default:
+        CheckFromString(input);
+        break;
+    }
+
+    return 0;
+}
+
+#ifdef CHROMA_FUZZ_STANDALONE
+#include <fstream>
+#include <iterator>
+#include <random>
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream file(argv[i], std::ios::binary);
+        const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        LLVMFuzzerTestOneInput(reinterpret_cast<const std::uint8_t*>(contents.data()), contents.size());
+    }
+
+    if (argc > 1)
+        return 0;
+
+    // A small alphabet makes patterns, whitespace and numbers likely to line up
+    constexpr std::string_view alphabet = "ab \n\t-+0129";
+    std::mt19937_64 random(0);
+    std::vector<std::uint8_t> input;
+    for (size_t run = 0; run < 1000000; ++run)
+    {
+        input.resize(random() % 64);
+        for (auto& byte : input)
+            byte = random() % 4 == 0 ? static_cast<std::uint8_t>(random()) : static_cast<std::uint8_t>(alphabet[random() % alphabet.size()]);
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+
+    return 0;
+}
+#endif
\ No newline at end of file